@@ -22,10 +22,27 @@
 
 #include "PageIndex.h"
 
-PageIndex::PageIndex(void)
+PageIndex::PageIndex(void):
+artDisambigUrls(urlPool),
+artUrls(urlPool),
+disambigUrls(urlPool),
+redirectFrom(urlPool),
+redirectTo(urlPool),
+templateUrls(urlPool)
 {
 }
 
+PageIndex::PageIndex(const BString& fileName):
+artDisambigUrls(urlPool),
+artUrls(urlPool),
+disambigUrls(urlPool),
+redirectFrom(urlPool),
+redirectTo(urlPool),
+templateUrls(urlPool)
+{
+	Load(fileName);
+}
+
 PageIndex::~PageIndex(void)
 {
 }
@@ -78,17 +95,97 @@ void PageIndex::Serialize(BArchive& ar)
 	templateXml.Serialize(ar);
 }
 
+//Same members in the same order as Serialize(), with the URL pool first
+void PageIndex::SerializeMapped(CMappedArchive& ar)
+{
+	ar & urlPool;
+	ar & artDisambigUrls & artUrls & disambigUrls & redirectFrom & redirectTo & redToADpageIndex & templateUrls;
+
+	ar & isListAD;
+
+	ar & renumFromADtoArt & renumFromArtToAD;
+
+	ar & numArtCited & numArtDisambigCited & numRedirectCited;
+
+	ar & similarArticles;
+
+	ar & linksFromForADpages & linksToForADpages;
+
+	ar & anchorsLowerMap & anchorsForADpages & freqAnchorsForADpages & adPagesForAnchors & freqADpagesForAnchors;
+
+	ar & lowerADWPtitleMap & pagesForLowerADWPtitles & lowerRedMap & redsForLowerReds;
+
+	ar & artDisambigUrlsWP & parenthAD & isADparenth;
+
+	ar & bSynLowerMap & bSynForADpages & adPagesForBSyn;
+
+	ar & imagesForADpages;
+
+	ar & templateXml;
+
+	ar & artDisambigMap & artMap & disambigMap & redirectFromMap & templateMap;
+}
+
+void PageIndex::BuildTitleIndexes()
+{
+	artDisambigMap.Build(artDisambigUrls);
+	artMap.Build(artUrls);
+	disambigMap.Build(disambigUrls);
+	redirectFromMap.Build(redirectFrom);
+	templateMap.Build(templateUrls);
+}
+
+bool PageIndex::SaveMapped(const BString& fileName)
+{
+	CMappedArchive ar;
+	if(!ar.OpenForSaving(fileName,mappedVersion)) return false;
+
+	SerializeMapped(ar);
+	return ar.Close();
+}
+
+//Empties the arrays that view the mapped file, the URL pool and the title indexes over it, and closes the file
+void PageIndex::CloseMapped()
+{
+	mappedArchive.Close();
+	urlPool.Clear();
+	artDisambigMap.Clear();
+	artMap.Clear();
+	disambigMap.Clear();
+	redirectFromMap.Clear();
+	templateMap.Clear();
+}
+
 bool PageIndex::Load(const BString& fileName)
 {
-	bool ret=Savable::Load(fileName);	//will call serialize
-	if(!ret) {return false;}
-
-	//Fill all maps
-	artDisambigMap.AddFromArray(artDisambigUrls);
-	artMap.AddFromArray(artUrls);
-	disambigMap.AddFromArray(disambigUrls);
-	redirectFromMap.AddFromArray(redirectFrom);
-	templateMap.AddFromArray(templateUrls);
+	CloseMapped();		//Before anything is loaded over the arrays that view a previously loaded file
+
+	//Old format - the title indexes are not in the file
+	if(!CMappedArchive::IsMappedArchive(fileName))
+	{
+		bool ret=Savable::Load(fileName);	//will call serialize, which interns the URLs
+		if(!ret) {return false;}
+
+		BuildTitleIndexes();
+		return true;
+	}
+
+	//The archive stays open - the loaded arrays are views of its mapped file
+	if(!mappedArchive.OpenForLoading(fileName,mappedVersion)) return false;
+
+	SerializeMapped(mappedArchive);
+	if(!mappedArchive.IsOk())
+	{
+		std::cerr << "The file is truncated or damaged: " << fileName << ".\n";
+		CloseMapped();
+		return false;
+	}
+
+	artDisambigMap.Attach(artDisambigUrls);
+	artMap.Attach(artUrls);
+	disambigMap.Attach(disambigUrls);
+	redirectFromMap.Attach(redirectFrom);
+	templateMap.Attach(templateUrls);
 
 	return true;
 }
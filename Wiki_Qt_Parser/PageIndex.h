@@ -25,23 +25,28 @@
 #include "Array.h"
 #include "CAIStrings.h"
 #include "BidirectionalMap.h"
+#include "MappedArchive.h"
+#include "StringHashIndex.h"
+#include "StringPool.h"
 
 class PageIndex : public Savable
 {
 public:
-	PageIndex(const BString& fileName){Load(fileName);};
+	PageIndex(const BString& fileName);
 	PageIndex(void);
 	~PageIndex(void);
 
 public:
-	//All URL strings in CHArray<BString>
-	CHArray<BString> artDisambigUrls;
-	CHArray<BString> artUrls;
-	CHArray<BString> disambigUrls;
-	CHArray<BString> redirectFrom;
-	CHArray<BString> redirectTo;
+	//All URL strings, each distinct string stored once in urlPool
+	//An article is in both artDisambigUrls and artUrls, and usually also a redirect target
+	CStringPool urlPool;
+	CPooledStringArray artDisambigUrls;
+	CPooledStringArray artUrls;
+	CPooledStringArray disambigUrls;
+	CPooledStringArray redirectFrom;
+	CPooledStringArray redirectTo;
 	CHArray<int> redToADpageIndex;	//indices of AD pages to which the redirect redirects
-	CHArray<BString> templateUrls;
+	CPooledStringArray templateUrls;
 
 	//For each article in artDisambigUrls, whether this is a list article
 	//Disambiguations are not considered list articles
@@ -97,25 +102,39 @@ public:
 	CAIStrings<char,int64> artDisambigXml;
 	CAIStrings<char,int64> templateXml;
 
-	//These maps are not stored in the file
-	//They are only filled on Load()
-	CBidirectionalMap<BString> artDisambigMap;
-	CBidirectionalMap<BString> artMap;
-	CBidirectionalMap<BString> disambigMap;
-	CBidirectionalMap<BString> redirectFromMap;
-	CBidirectionalMap<BString> templateMap;
+	//Title lookups in the URL arrays above
+	//Built with BuildTitleIndexes() and saved with the page index in the mapped format,
+	//built on Load() for files in the old format
+	CStringHashIndex artDisambigMap;
+	CStringHashIndex artMap;
+	CStringHashIndex disambigMap;
+	CStringHashIndex redirectFromMap;
+	CStringHashIndex templateMap;
+	void BuildTitleIndexes();
 
 	//Some convenience functions
 	bool IsDisambig(int ADindex){return renumFromADtoArt[ADindex]==-1;};		//Whether a page in AD is a disambiguation
 
+private:
+	CMappedArchive mappedArchive;		//Holds the mapped file that the loaded arrays view - declared after them
+	void CloseMapped();
+
+public:
+
 	//Serialization
 	void LoadArtDisambigXml(const BString& fileName){artDisambigXml.Load(fileName);};
 	void SaveArtDisambigXml(const BString& fileName){artDisambigXml.Save(fileName);};
-	bool Load(const BString& fileName);
+	bool Load(const BString& fileName);		//Loads either format
 	void Serialize(BArchive& ar);
 
+	//Memory-mapped format (see MappedArchive.h) - the arrays and CAIS are loaded as views of the file
+	bool SaveMapped(const BString& fileName);
+	void SerializeMapped(CMappedArchive& ar);
+	enum {mappedVersion = 3};		//Increment when the list of members in SerializeMapped() changes
+
 	void Clear()
 	{
+		CloseMapped();		//Also clears the URL pool and the title indexes
 		artUrls.EraseArray();
 		artDisambigUrls.EraseArray();
 		isListAD.EraseArray();
@@ -5,6 +5,7 @@
 #include "boost/thread.hpp"
 #include "Common.h"
 #include "SimpleXml.h"
+#include "XmlTags.h"
 #include "pugixml.hpp"
 #include "StringTree.h"
 #include "StdMap.h"
@@ -112,6 +113,7 @@ template<typename F>
 void ThreadedIndexer::ApplyToPages(F&& FunctionToCall)
 {
 	BString page;
+	BString docBuffer;		//The document is parsed in place, page is reused for the next page
 	int pageNum;
 	GetNextADpage(page,pageNum);
 	
@@ -119,7 +121,7 @@ void ThreadedIndexer::ApplyToPages(F&& FunctionToCall)
 	{
 		//Parse it to XML
 		xml_document doc;
-		StringToXml(doc,page);
+		StringToXmlInPlace(doc,page,docBuffer);
 		//Call the function on the document
 		FunctionToCall(doc,pageNum);
 
@@ -132,6 +134,7 @@ template<typename F>
 void ThreadedIndexer::ApplyToStringsInADXml(F&& FunctionToCall)
 {
 	BString page;
+	BString docBuffer;		//The document is parsed in place, page is reused for the next page
 	int pageNum;
 	GetNextADpage(page,pageNum);
 	
@@ -139,7 +142,7 @@ void ThreadedIndexer::ApplyToStringsInADXml(F&& FunctionToCall)
 	{
 		//Parse it to XML
 		xml_document doc;
-		StringToXml(doc,page);
+		StringToXmlInPlace(doc,page,docBuffer);
 
 		//Call the function on the document
 		ApplyToStringsInNode(doc,pageNum,FunctionToCall);
@@ -155,8 +158,8 @@ void ThreadedIndexer::ApplyToStringsInNode(xml_node& node, int pageNum, F&& Func
 {
 	if(node.type()!=node_element && node.type()!=node_document) return;
 
-	BString nodeName=node.name();
-	if(nodeName=="par" || nodeName=="listEl" || nodeName=="title" || nodeName=="secTitle")		//This is a "printable" node
+	XmlTag tag=XmlTags::GetTag(node);
+	if(tag==tagPar || tag==tagListEl || tag==tagTitle || tag==tagSecTitle)		//This is a "printable" node
 	{
 		BString string;
 		WriteContentToString(node,string);
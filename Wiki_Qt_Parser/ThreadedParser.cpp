@@ -39,12 +39,22 @@ dummyParser(parserConfigFile,true)
 	xmlFileName = "xml_of_articles_and_disambigs.xml";
 	iiaFileName = "ADiia.ari64";			//Article and disambig initial index array in xmlFileName
 	pIndexFileName = "page_index.cust";
+	plainTextFileName = "articles_in_plain_text.txt";
 
 	//Options
 	fShortReport				= false;
 	fDiscardLists				= false;
 	fDiscardDisambigs			= false;
+	fInfoboxOnly				= false;
 	fWritePageIndex				= true;
+	pageTimeBudget				= 0;
+	fAbortOverBudget			= false;
+	textRenderer				= NULL;
+	sectionThreads				= 4;
+	parallelPageSize			= 200000;
+	largePageSize				= 1000000;
+	fPassTiming					= false;
+	xmlBlockSize				= 0;
 
 	//Other initializations
 	fRunning = false;
@@ -52,12 +62,7 @@ dummyParser(parserConfigFile,true)
 	readSize=500000000;			//Reads in chunks of 500 MB
 	buffer.ResizeArray(readSize);
 
-	pageIndex.artUrls.ResizeArray(6000000);
-	pageIndex.artDisambigUrls.ResizeArray(7000000);
-	pageIndex.redirectFrom.ResizeArray(8000000);
-	pageIndex.redirectTo.ResizeArray(8000000);
-	pageIndex.disambigUrls.ResizeArray(500000);
-	pageIndex.templateUrls.ResizeArray(100000);
+	//The URL arrays and their string pool grow as pages are added
 	pageIndex.isListAD.ResizeArray(8000000);
 	pageIndex.templateXml.ResizeIfSmaller(50000000,100000);
 
@@ -81,12 +86,27 @@ void ThreadedParser::ClearData()
 	numDisambigs=0;
 	numOtherPages=0;
 	numFailed=0;
+	numPlainTextPages=0;
+	nextPlainTextPage=0;
+
+	for(int i=0;i<2;i++)
+	{
+		lanePages[i]=0;
+		laneBytes[i]=0;
+		laneSeconds[i]=0;
+	}
+	numActiveLarge=0;
 
 	pageIndex.Clear();
 
 	xmlADsplitWriter.Clear();		//Not really necessary, gets cleared on Open()
 	
 	dummyParser.ClearErrorMaps();
+	dummyParser.ClearStats();
+	errorsGeneral.Clear();
+	errorsRedirects.Clear();
+	errorsTemplates.Clear();
+	errorsArtDisambigs.Clear();
 }
 
 void ThreadedParser::Parse(boost_istreambuf* theFile,int numThreads,
@@ -99,6 +119,12 @@ void ThreadedParser::Parse(boost_istreambuf* theFile,int numThreads,
 	file=theFile;
 	curBufferOffset=0;
 	buffer.SetNumPoints(0);
+	chunkPageBegin.SetNumPoints(0);
+	chunkPageEnd.SetNumPoints(0);
+	smallLane.SetNumPoints(0);
+	largeLane.SetNumPoints(0);
+	nextSmall=0;
+	nextLarge=0;
 	eofReached = false;
 	fRunning = true;
 	ClearData();
@@ -107,11 +133,16 @@ void ThreadedParser::Parse(boost_istreambuf* theFile,int numThreads,
 	//Save some params for reporting later
 	startTimeString = CommonUtility::CurDateTimeString("%Y-%m-%d %H:%M:%S");
 	threadsUsed = numThreads;
+	maxActiveLarge = numThreads/2;
+	if(maxActiveLarge < 1) maxActiveLarge = 1;
 	outputDir = saveFolder;
 
 	//If prependToXML is not "", we'll prepend that string to the storage file
 	//Without including it in the CAIS
+	xmlADsplitWriter.SetBlockCompression(xmlBlockSize,numThreads);
 	xmlADsplitWriter.Open(saveFolder + xmlFileName,prependToXML);
+	if(textRenderer != NULL && !plainTextWriter.Open(saveFolder + plainTextFileName))
+		std::cerr << "Could not open file for writing: " << saveFolder + plainTextFileName << ".\n";
 
 	//Launch workers through a wrapper function
 	if(fSynchronous)	//Synchronous operation - launch wrapper function from current thread
@@ -155,19 +186,37 @@ void ThreadedParser::ParsingThread()
 	//Locking around parser creation - is it necessary?
 	mutex.lock();
 	CWikipediaParser parser(configFile,true);		//Each thread has its own parser
+	parser.discardedSections=dummyParser.discardedSections;
+	parser.SetPageTimeBudget(pageTimeBudget,fAbortOverBudget);
+	parser.SetParallelSections(sectionThreads,parallelPageSize);
+	parser.SetPassTiming(fPassTiming);
 	mutex.unlock();
 
+	//Per-thread buffers, reused for every page - the page XML is printed directly into curPageText
+	//and written from there to the storage file
 	BString page;
 	BString curPageText;
+	BString curPlainText;
 	BString redirectTarget;
+	bool fLargePage;
+	CTimer pageTimer;
 
 	while(1)
 	{
-		GetNextPage(page);
+		GetNextPage(page,fLargePage);
 		if(page=="") break;
 
+		int64 pageBytes=page.GetLength();
+		pageTimer.SetTimerZero(0);
+
 		pugi::xml_document xmlDoc;
-		if(!parser.ParseArticle(page,xmlDoc))		//Page parse failure
+		bool fParsed;
+		if(fInfoboxOnly) fParsed=parser.ExtractInfoboxes(page,xmlDoc);
+		else fParsed=parser.ParseArticle(page,xmlDoc);
+
+		PageDone(fLargePage,pageBytes,pageTimer.GetCurTime(0));
+
+		if(!fParsed)		//Page parse failure
 		{
 			boost::recursive_mutex::scoped_lock lock(mutex);
 			numFailed++;
@@ -176,6 +225,7 @@ void ThreadedParser::ParsingThread()
 
 		BString type=xmlDoc.child("page").attribute("type").value();
 		BString list=xmlDoc.child("page").attribute("list").value();
+		bool fHasInfobox=!xmlDoc.child("page").child("infobox").empty();
 		char fList=0;
 		if(list=="yes") {fList=1;numListAD++;}
 
@@ -187,11 +237,21 @@ void ThreadedParser::ParsingThread()
 			continue;
 		}
 
-		//If article or disambig, write XML to string
-		if(type=="article" || type=="disambig")
+		//Whether an article or disambig is saved - decided here, so that only saved pages are printed
+		//For articles that aren't lists, and for lists when not discarding them
+		//In infobox-only mode, only the pages that have infoboxes
+		bool fSave=false;
+		if(type=="article") fSave=(!fList || !fDiscardLists) && (!fInfoboxOnly || fHasInfobox);
+		if(type=="disambig") fSave=!fDiscardDisambigs && (!fInfoboxOnly || fHasInfobox);
+
+		//If a saved article or disambig, write XML to string
+		//and render the plain text from the same document, if requested
+		if(fSave)
 		{
 			SimplestXml::XmlToString(xmlDoc,curPageText,true);
+			if(textRenderer != NULL) textRenderer->WriteContentToString(xmlDoc,curPlainText);
 		}
+		int plainTextTicket=-1;		//Order of the page in the plain text file, taken with the XML, -1 if no plain text is written
 
 		//If this is the right kind of template, save its XML too
 		bool fUsefulTemplate=false;
@@ -223,10 +283,10 @@ void ThreadedParser::ParsingThread()
 			{
 				if(!fList) numArticles++;		//We don't count list articles into the total number of articles
 
-				//For articles that aren't lists, and for lists when not discarding them
-				if(!fList || !fDiscardLists)
+				if(fSave)
 				{
 					xmlADsplitWriter.AddCharString(curPageText,false);
+					if(textRenderer != NULL) plainTextTicket=numPlainTextPages++;
 					pageIndex.artDisambigUrls.AddAndExtend(url);
 					pageIndex.isListAD.AddAndExtend(fList);
 					lastArticleTitle = url;
@@ -240,9 +300,10 @@ void ThreadedParser::ParsingThread()
 				numDisambigs++;
 
 				//If not discarding disambiguations
-				if(!fDiscardDisambigs)
+				if(fSave)
 				{
 					xmlADsplitWriter.AddCharString(curPageText,false);
+					if(textRenderer != NULL) plainTextTicket=numPlainTextPages++;
 					pageIndex.artDisambigUrls.AddAndExtend(url);
 					pageIndex.isListAD.AddAndExtend(fList);
 					lastArticleTitle = url;
@@ -269,13 +330,21 @@ void ThreadedParser::ParsingThread()
 				}
 			}
 		}	//End locked scope
+
+		//The plain text is written after the lock is released, in the order of the tickets
+		if(plainTextTicket != -1) WritePlainText(curPlainText,plainTextTicket);
 	}
 
 	//There are no more pages in the data file
-	//Copy errors from the thread-local parser into the error maps in the dummy parser
+	//Merge errors from the thread-local parser into the shared error maps - their shards are locked separately
+	errorsGeneral.AddFromMap(parser.errorMapGeneral);
+	errorsRedirects.AddFromMap(parser.errorMapRedirects);
+	errorsTemplates.AddFromMap(parser.errorMapTemplates);
+	errorsArtDisambigs.AddFromMap(parser.errorMapArtDisambigs);
+
 	{
 		boost::recursive_mutex::scoped_lock lock(mutex);
-		dummyParser.AppendErrorMaps(parser);
+		dummyParser.AppendStats(parser);
 	}
 
 	//Thread is exiting
@@ -305,6 +374,24 @@ void ThreadedParser::DecrementThreads()
 	numActiveThreads --;
 }
 
+//Moves the merged worker errors into the dummy parser, after all workers have exited
+//Ordered by frequency with ties by error text, so the report does not depend on thread timing
+void ThreadedParser::FreezeErrorMaps()
+{
+	typedef CConcurrentBidirectionalMap<BString> ErrorMap;
+
+	errorsGeneral.Freeze(ErrorMap::orderByFrequency);
+	errorsRedirects.Freeze(ErrorMap::orderByFrequency);
+	errorsTemplates.Freeze(ErrorMap::orderByFrequency);
+	errorsArtDisambigs.Freeze(ErrorMap::orderByFrequency);
+
+	dummyParser.ClearErrorMaps();
+	dummyParser.errorMapGeneral.AddFromMap(errorsGeneral.frozenMap);
+	dummyParser.errorMapRedirects.AddFromMap(errorsRedirects.frozenMap);
+	dummyParser.errorMapTemplates.AddFromMap(errorsTemplates.frozenMap);
+	dummyParser.errorMapArtDisambigs.AddFromMap(errorsArtDisambigs.frozenMap);
+}
+
 void ThreadedParser::SaveData(const BString& saveFolder, std::ostream& report)
 {
 	//Write parse report file
@@ -318,13 +405,17 @@ void ThreadedParser::SaveData(const BString& saveFolder, std::ostream& report)
 	int h, m, s;
 	CommonUtility::SecondsToHMS((int)timer.GetCurTime(0),h,m,s);
 	report << "Parsing took a total of: " << h << " hours, " << m << " minutes, " << s << " seconds.\n";
-	report << "Number of parsing threads used: " << threadsUsed << " threads.\n\n";
+	report << "Number of parsing threads used: " << threadsUsed << " threads.\n";
+	if(sectionThreads > 1) report << "Sections of pages larger than " << parallelPageSize << " bytes were parsed in up to " << sectionThreads << " parallel jobs.\n";
+	report << "\n";
 	
 	//Indicate whether we are discarding lists of disambiguations
 	if(fDiscardLists) report << "List-like articles were discarded during the parse.\n";
 	if(fDiscardDisambigs) report << "Disambiguation pages were discarded during the parse.\n";
 	if(fDiscardLists || fDiscardDisambigs) report << "\n";
 
+	if(fInfoboxOnly) report << "Infobox-only extraction: only the infobox records of pages with infoboxes were saved to the XML file.\n\n";
+
 	report << "Total number of pages that were successfully parsed: " << numPagesParsed << ".\n";
 	report << "Number of pages that failed to parse: " << numFailed <<".\n\n";
 	report << "Number of articles among the parsed pages (exclusing lists): " << numArticles << ".\n";
@@ -337,6 +428,51 @@ void ThreadedParser::SaveData(const BString& saveFolder, std::ostream& report)
 
 	report << "\nNumber of redirects among the parsed pages: " << numRedirects << ".\n";
 	report << "Number of other pages - Wikipedia, File, Category, Template, etc. (discarded): " << numOtherPages << ".\n\n";
+	//Throughput of the small and large page lanes, in worker time
+	for(int i=0;i<2;i++)
+	{
+		if(i==0) report << "Small pages: ";
+		else report << "Large pages (" << largePageSize << " bytes or more, parsed largest-first): ";
+
+		report << lanePages[i] << " pages, " << laneBytes[i] << " bytes, " << (int)laneSeconds[i] << " seconds of worker time";
+		if(laneSeconds[i] > 0) report << ", " << (laneBytes[i]/laneSeconds[i])/1000000 << " MB/s per thread";
+		report << ".\n";
+	}
+	report << "\n";
+
+	report << "Sections skipped before parsing by title (References, External links, etc.): " << dummyParser.numSkippedSections
+			<< ", totaling " << dummyParser.skippedSectionBytes << " bytes.\n\n";
+
+	if(pageTimeBudget > 0)
+	{
+		report << "Pages over the time budget of " << pageTimeBudget << " seconds (";
+		if(fAbortOverBudget) report << "aborted";
+		else report << "degraded";
+		report << "): " << dummyParser.overBudgetTitles.Count() << ".\n";
+
+		if(!fShortReport)
+		{
+			for(int i=0;i<dummyParser.overBudgetTitles.Count();i++) report << "\t\t" << dummyParser.overBudgetTitles[i] << "\n";
+		}
+		report << "\n";
+	}
+
+	int64 numConverts = dummyParser.templateCacheHits + dummyParser.templateCacheMisses;
+	if(numConverts > 0)
+	{
+		report << "Convert templates rendered: " << numConverts << ", copied from the template cache: " << dummyParser.templateCacheHits
+				<< " (" << (100.0*dummyParser.templateCacheHits)/numConverts << "% hit rate).\n\n";
+	}
+
+	if(fPassTiming)
+	{
+		report << "Post-processing time by pass, in worker time:\n";
+		for(int i=0;i<dummyParser.passTimeNames.Count();i++)
+		{
+			report << "\t\t" << dummyParser.passTimeNames[i] << ": " << dummyParser.passTimeSeconds[i] << " seconds.\n";
+		}
+		report << "\n";
+	}
 
 	report << "Types of pages saved to the XML file: \n";
 	report << "\t\tNon-list articles\n";
@@ -344,10 +480,18 @@ void ThreadedParser::SaveData(const BString& saveFolder, std::ostream& report)
 	if(!fDiscardDisambigs) report << "\t\tDisambiguations\n";
 	report << "Number of qualifying parsed pages saved to the XML file: " << xmlADsplitWriter.Count() << ".\n\n";
 
+	if(textRenderer != NULL)
+	{
+		report << "Plain text was written during the parse to: " << plainTextFileName << "\n";
+		textRenderer->ReportSettings(report);
+		report << "Number of pages written as plain text: " << numPlainTextPages << ".\n\n";
+	}
+
 	if(!fShortReport)
 	{
 		report<<"Number of infobox templates: " << numTemplates << "\n";
 		report<<"Size of XML text for articles + disambiguations: " << xmlADsplitWriter.StorageSize() << ".\n";
+		if(xmlBlockSize > 0) report<<"The XML text is block-compressed in blocks of " << xmlBlockSize << " bytes.\n";
 		report<<"Size of XML text for templates: " << pageIndex.templateXml.storageArr.Count() << ".\n";
 
 		report<<"\nOutputs:\n";
@@ -355,42 +499,59 @@ void ThreadedParser::SaveData(const BString& saveFolder, std::ostream& report)
 		report<<"xml_of_articles_and_disambigs.isc64\n";
 
 		//Parser output from the dummy parser, which accumulated all error output:
+		FreezeErrorMaps();
 		dummyParser.WriteReport(report);
 	}
 	
 	//Write all data
-	if(fWritePageIndex) pageIndex.Save(saveFolder + pIndexFileName);
+	if(fWritePageIndex)
+	{
+		pageIndex.BuildTitleIndexes();
+		pageIndex.SaveMapped(saveFolder + pIndexFileName);
+	}
 	
 	//Save init index for articles and disambigs
 	xmlADsplitWriter.Close();
 	xmlADsplitWriter.SaveInitIndex(saveFolder + iiaFileName);
+
+	if(plainTextWriter.IsOpen() && !plainTextWriter.Close())
+		std::cerr << "Could not write the plain text file: " << saveFolder + plainTextFileName << ".\n";
 }
 
 //page will have the next page in it, with <page> and </page> markers
 //or will be empty if there are no pages left in the file
-void ThreadedParser::GetNextPage(BString& page)
+void ThreadedParser::GetNextPage(BString& page, bool& fLargePage)
 {
 	boost::recursive_mutex::scoped_lock lock(mutex);
 
 	if(numPagesParsed > maxPagesToParse || stopFlag) {page="";return;};
 
-	int64 beginPos=buffer.FindSequence(pageBegin,curBufferOffset);
-	int64 endPos=-1;
-	if(beginPos!=-1) endPos=buffer.FindSequence(pageEnd,beginPos);
-
-	if(beginPos==-1 || endPos==-1)
+	//Both lanes are empty - read and index the next chunk
+	if(nextSmall>=smallLane.Count() && nextLarge>=largeLane.Count())
 	{
 		if(eofReached) {page="";return;}
 
-		else
-		{
-			ReadNextChunk();							//curBufferOffset will be set to 0
-			beginPos=buffer.FindSequence(pageBegin,curBufferOffset);
-			if(beginPos!=-1) endPos=buffer.FindSequence(pageEnd,beginPos);
+		ReadNextChunk();							//curBufferOffset will be set to 0
+		IndexChunk();
 
-			if(beginPos==-1 || endPos==-1) {page="";return;}	//Still could not find page markers - return;
-		}
+		if(smallLane.Count()==0 && largeLane.Count()==0) {page="";return;}	//Still could not find page markers - return;
+	}
+
+	//Large pages are started first, as long as there are free large-page slots
+	//Once small pages run out, the remaining large pages are taken regardless
+	bool fLargeAvailable=(nextLarge<largeLane.Count());
+	fLargePage=fLargeAvailable && (numActiveLarge<maxActiveLarge || nextSmall>=smallLane.Count());
+
+	int64 index;
+	if(fLargePage)
+	{
+		index=largeLane[nextLarge++];
+		numActiveLarge++;
 	}
+	else index=smallLane[nextSmall++];
+
+	int64 beginPos=chunkPageBegin[index];
+	int64 endPos=chunkPageEnd[index];
 
 	copyArray.ResizeIfSmaller(endPos-beginPos+pageEnd.Count()+1);
 	buffer.ExportPart(copyArray,beginPos,endPos-beginPos+pageEnd.Count());
@@ -402,8 +563,80 @@ void ThreadedParser::GetNextPage(BString& page)
 	//Add a NULL and copy to string
 	copyArray.AddPoint(NULL);
 	page=copyArray.arr;
+}
+
+//Indexes all complete pages in the buffer, starting at curBufferOffset, and splits them into lanes
+void ThreadedParser::IndexChunk()
+{
+	boost::recursive_mutex::scoped_lock lock(mutex);
+	fReadingData = true;		//Indexing is part of reading, stats are not waited for
+
+	chunkPageBegin.SetNumPoints(0);
+	chunkPageEnd.SetNumPoints(0);
+	smallLane.SetNumPoints(0);
+	largeLane.SetNumPoints(0);
+	nextSmall=0;
+	nextLarge=0;
+
+	CHArray<int64,int64> largeSizes;
+	while(1)
+	{
+		int64 beginPos=buffer.FindSequence(pageBegin,curBufferOffset);
+		if(beginPos==-1) break;
+		int64 endPos=buffer.FindSequence(pageEnd,beginPos);
+		if(endPos==-1) break;
+
+		int64 index=chunkPageBegin.Count();
+		chunkPageBegin.AddAndExtend(beginPos);
+		chunkPageEnd.AddAndExtend(endPos);
+
+		int64 size=endPos-beginPos+pageEnd.Count();
+		if(largePageSize>0 && size>=largePageSize)
+		{
+			largeLane.AddAndExtend(index);
+			largeSizes.AddAndExtend(size);
+		}
+		else smallLane.AddAndExtend(index);
+
+		curBufferOffset=endPos;		//The unprocessed remainder of the buffer starts here
+	}
+
+	//Largest pages first
+	if(largeLane.Count()>1)
+	{
+		CHArray<int64,int64> perm;
+		largeSizes.SortPermutation(perm,true);
+		largeLane.Permute(perm);
+	}
+
+	fReadingData = false;
+}
+
+//Writes the plain text of a saved page, without holding the parser lock
+//The ticket is taken under the lock when the XML is added, so the pages are written in the same order as the XML
+//A thread only waits here for the threads that saved a page just before it to hand their text to the writer
+void ThreadedParser::WritePlainText(const BString& text, int ticket)
+{
+	boost::mutex::scoped_lock lock(plainTextMutex);
+	while(nextPlainTextPage != ticket) plainTextCondition.wait(lock);
+
+	plainTextWriter.Write(text.c_str(),text.GetLength());
+
+	nextPlainTextPage++;
+	plainTextCondition.notify_all();
+}
+
+//Updates lane statistics after a page is parsed, releases the slot in the large-page lane
+void ThreadedParser::PageDone(bool fLargePage, int64 pageBytes, double seconds)
+{
+	boost::recursive_mutex::scoped_lock lock(mutex);
+
+	int lane=fLargePage ? 1 : 0;
+	lanePages[lane]++;
+	laneBytes[lane]+=pageBytes;
+	laneSeconds[lane]+=seconds;
 
-	curBufferOffset=beginPos+1;
+	if(fLargePage) numActiveLarge--;
 }
 
 void ThreadedParser::ReadNextChunk()
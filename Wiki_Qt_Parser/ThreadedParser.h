@@ -28,8 +28,11 @@
 #include "CAIStrings.h"
 #include "CAISSplitWriter.h"
 #include "BidirectionalMap.h"
+#include "ConcurrentBidirectionalMap.h"
 #include "WikipediaParser.h"
 #include "PageIndex.h"
+#include "ThreadedWriter.h"
+#include "AsyncFileWriter.h"
 #include <iostream>
 #include <fstream>
 
@@ -78,12 +81,28 @@ public:
 	void SetShortReport(bool val)		{fShortReport = val;};
 	void SetDiscardLists(bool val)		{fDiscardLists = val;};
 	void SetDiscardDisambigs(bool val)	{fDiscardDisambigs = val;};
+	void SetInfoboxOnly(bool val)		{fInfoboxOnly = val;};
 	void SetInputFileForReport(const BString& file) {inputFileForReport = file;};
 	void SetXmlFileName(const BString& file) {xmlFileName = file;};
 	void SetIiaFileName(const BString& file) {iiaFileName = file;};
 	void SetPageIndexFileName(const BString& file) {pIndexFileName = file;};
 	void SetWritePageIndex(bool val) {fWritePageIndex = val;};
 	void SetPrependToXML(const BString& string) {prependToXML = string;};
+	void SetDiscardedSections(const CHArray<BString>& titles) {dummyParser.SetDiscardedSections(titles);};
+	void SetPageTimeBudget(double seconds, bool fAbort=false) {pageTimeBudget = seconds; fAbortOverBudget = fAbort;};
+	void SetParallelSections(int numThreads, int minPageSize) {sectionThreads = numThreads; parallelPageSize = minPageSize;};
+	void SetLargePageSize(int64 minBytes) {largePageSize = minBytes;};	//0 disables the large-page lane
+	void SetPassTiming(bool val) {fPassTiming = val;};	//Reports the time spent in each post-processing pass
+
+	//Block-compresses the XML storage file in blocks of blockSize bytes (see BlockCompressor.h), 0 - plain XML (default)
+	//The compressed file is only readable through CAISFileFetcher, with the block index saved next to the iia
+	void SetXmlBlockCompression(int64 blockSize) {xmlBlockSize = blockSize;};
+
+	//If a renderer is set, the workers write the plain text of every saved page to the plain text file
+	//straight from the parsed XML, in the same order as the XML file, using the renderer's write options
+	//This replaces a separate ThreadedWriter pass over the XML file. NULL (default) - no plain text is written
+	void SetPlainTextRenderer(ThreadedWriter* renderer) {textRenderer = renderer;};
+	void SetPlainTextFileName(const BString& file) {plainTextFileName = file;};
 
 private:
 	//Worker threads
@@ -107,18 +126,36 @@ private:
 	BString xmlFileName;
 	BString iiaFileName;
 	BString pIndexFileName;
+	BString plainTextFileName;
 
 	//Options
 	bool fShortReport;
 	bool fDiscardLists;
 	bool fDiscardDisambigs;
+	bool fInfoboxOnly;			//Infobox-only extraction - only articles with infoboxes are saved, as compact infobox records
 	bool fWritePageIndex;		//Whether the page index file is written at the end of the parse
+	double pageTimeBudget;		//Per-page time budget in seconds for the worker parsers, 0 - no budget
+	bool fAbortOverBudget;		//Whether pages over budget are aborted (otherwise degraded)
+	ThreadedWriter* textRenderer;	//Renders plain text in the workers, NULL if plain text is not written during the parse
+	int sectionThreads;			//Number of threads that parse the sections of a large page
+	int parallelPageSize;		//Pages with at least this many bytes of text have their sections parsed in parallel
+	bool fPassTiming;			//Whether the post-processing passes are timed
+	int64 xmlBlockSize;			//Block size of the compressed XML storage, 0 - not compressed
 	BString prependToXML;		//The string that can be prepended to the XML storage file, but not included in the CAIS
 
 	CTimer timer;
 	CCommon common;
 	BString configFile;
 	CWikipediaParser dummyParser;		//A parser just to store the error output from the actual working parsers
+										//and the options (discarded sections) that are copied into them
+
+	//Error maps of the worker parsers, merged by each worker as it exits without taking the parser mutex
+	//Frozen into the dummy parser's error maps before the report is written
+	CConcurrentBidirectionalMap<BString> errorsGeneral;
+	CConcurrentBidirectionalMap<BString> errorsRedirects;
+	CConcurrentBidirectionalMap<BString> errorsTemplates;
+	CConcurrentBidirectionalMap<BString> errorsArtDisambigs;
+	void FreezeErrorMaps();
 
 	//Params to save for reporting at the end of the parse
 	BString startTimeString;			//A string with start time
@@ -128,8 +165,33 @@ private:
 
 	//page will have the next page in it, with <page> and </page> markers
 	//or will be empty if there are no pages left in the file
-	void GetNextPage(BString& page);
+	//fLargePage is set if the page came from the large-page lane
+	void GetNextPage(BString& page, bool& fLargePage);
 	void ReadNextChunk();	//read next chunk from the file, leaving in the buffer whatever hasn't been processed
+
+	//Page dispatch: when a chunk is read, all complete pages in it are indexed and split into two lanes
+	//Pages of at least largePageSize bytes go to the large-page lane, which is dispatched largest-first
+	//so that the large pages overlap with the bulk of small pages instead of forming a tail
+	//At most maxActiveLarge threads work on large pages at the same time
+	void IndexChunk();
+	void PageDone(bool fLargePage, int64 pageBytes, double seconds);	//Lane statistics, releases the large-page slot
+
+	void WritePlainText(const BString& text, int ticket);
+
+	CHArray<int64,int64> chunkPageBegin;	//Positions of complete pages in the buffer
+	CHArray<int64,int64> chunkPageEnd;
+	CHArray<int64,int64> smallLane;			//Indices of small pages in chunkPageBegin, in file order
+	CHArray<int64,int64> largeLane;			//Indices of large pages in chunkPageBegin, largest first
+	int64 nextSmall;
+	int64 nextLarge;
+	int64 largePageSize;
+	int numActiveLarge;
+	int maxActiveLarge;
+
+	//Per-lane statistics, 0 - small pages, 1 - large pages
+	int64 lanePages[2];
+	int64 laneBytes[2];
+	double laneSeconds[2];				//Total worker time spent on the pages of the lane
 	
 	boost_istreambuf* file;	//the file buffer on which we can call "read" - may be reading from bz2 or plain file, we don't care
 	bool eofReached;
@@ -162,5 +224,10 @@ private:
 	PageIndex pageIndex;
 
 	CAISSplitWriter<char,int64> xmlADsplitWriter;			//XML text for all articles and disambiguations stored as separate data and iia
+	CAsyncFileWriter plainTextWriter;						//Plain text for the same pages, if textRenderer is set
+	boost::mutex plainTextMutex;							//Orders the plain text writes, see WritePlainText()
+	boost::condition_variable plainTextCondition;
+	int nextPlainTextPage;									//Ticket of the next page to be written as plain text
+	int numPlainTextPages;
 };
 
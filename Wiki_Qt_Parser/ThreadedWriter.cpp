@@ -25,6 +25,8 @@
 #include "DizzyUtility.h"
 #include "CommonUtility.h"
 #include "SimpleXml.h"
+#include "XmlTags.h"
+#include "boost/bind.hpp"
 #include <fstream>
 using namespace pugi;
 
@@ -32,12 +34,17 @@ ThreadedWriter::ThreadedWriter()
 {
 	fRunning = false;
 	stopFlag = false;
+	numPagesWritten = 0;
+
+	blockSize = 64;
+	maxBlocksAhead = 256;
 
 	//Default options
 	fSkipImCaptions = false;
 	fMarkArticles = true;
 	fMarkSections = true;
 	fMarkCaptions = true;
+	numThreads = 1;
 }
 
 //Processes a split CAIS into a text file
@@ -49,49 +56,116 @@ void ThreadedWriter::Process(	const BString& storageFile,
 	stopFlag = false;
 	fRunning = true;
 	numPagesWritten = 0;
-	lastPageTitle = "";
+	std::atomic_store(&lastPageTitle, std::shared_ptr<const BString>());
 
 	startTimeString = CommonUtility::CurDateTimeString("%Y-%m-%d %H:%M:%S");
 	timer.SetTimerZero(0);
 
-	//Pass the request into a worker thread and return immediately
-	boost::thread worker(	&ThreadedWriter::WorkerThread,this,
+	//Pass the request into a wrapper thread and return immediately
+	boost::thread wrapper(	&ThreadedWriter::WrapperThread,this,
 							storageFile,
 							iiaFile,
 							outputFile);
-	worker.detach();
+	wrapper.detach();
 }
 
-void ThreadedWriter::WorkerThread(	BString storageFile,
+void ThreadedWriter::WrapperThread(	BString storageFile,
 									BString iiaFile,
 									BString outputFile)
 {
+	outstream.open(outputFile, std::ios::binary);
+	readyBlocks.clear();
+	nextBlockToWrite = 0;
+	nextBlockToRender = 0;
+
+	//The fetcher takes no locks, all workers read from it
+	//Blocks are taken in page order, so the storage is read nearly sequentially
 	CAISFileFetcher<char,int64> cais(storageFile,iiaFile);
-	std::ofstream outstream(outputFile, std::ios::binary);
+	cais.AdviseSequential();
 
-	for(int64 i=0; i < cais.Count(); i++)
+	boost::thread_group threads;
+	for(int i=0;i<numThreads;i++)
 	{
-		if(stopFlag) break;
+		threads.create_thread(boost::bind(&ThreadedWriter::WorkerThread,this,&cais));
+	}
+	threads.join_all();
 
-		BString curPage;
-		cais.GetCharStringAt(i,curPage);
-		
-		xml_document doc;
-		SimplestXml::StringToXml(doc, curPage);
+	outstream.close();
+	fRunning = false;
+}
+
+void ThreadedWriter::WorkerThread(const CAISFileFetcher<char,int64>* cais)
+{
+	BString curPage;
+	BString text;
+	BString title;
 
-		BString text;	
-		WriteContentToString(doc, text);
+	while(!stopFlag)
+	{
+		int64 blockIndex = nextBlockToRender++;
+		int64 first = blockIndex*blockSize;
+		int64 last = first + blockSize;
+		if(first >= cais->Count()) break;
+		if(last > cais->Count()) last = cais->Count();
 
-		outstream.write(text,text.GetLength());
+		ThreadedWriterBlock block;
+		block.numPages = (int)(last-first);
 
+		for(int64 i=first; i < last; i++)
 		{
-			boost::recursive_mutex::scoped_lock lock(statMutex);
-			numPagesWritten ++;
-			lastPageTitle = doc.child("page").child("title").first_child().value();
+			//Rendered straight from the mapped storage if possible
+			int64 length;
+			const char* page = cais->GetElementView(i,length);
+			if(page != NULL)
+			{
+				const char* zero = (const char*)memchr(page,0,(size_t)length);
+				if(zero != NULL) length = zero-page;
+				StreamContentToString(page, length, text, title);
+			}
+			else
+			{
+				cais->GetCharStringAt(i,curPage);
+				StreamContentToString(curPage, text, title);
+			}
+			block.text += text;
 		}
+		block.lastTitle = title;
+
+		SubmitBlock(blockIndex, block);
 	}
 
-	fRunning = false;
+	//Wake up the workers that may be waiting for this one, in case it is exiting on stop
+	orderCondition.notify_all();
+}
+
+//Places a rendered block into the reorder buffer and writes all blocks that are next in order
+void ThreadedWriter::SubmitBlock(int64 blockIndex, ThreadedWriterBlock& block)
+{
+	boost::mutex::scoped_lock lock(orderMutex);
+
+	//Do not run too far ahead of the writing position - bounds the memory held by the reorder buffer
+	while(blockIndex >= nextBlockToWrite + maxBlocksAhead && !stopFlag) orderCondition.wait(lock);
+	if(stopFlag) return;
+
+	ThreadedWriterBlock& stored = readyBlocks[blockIndex];
+	stored.text.swap(block.text);
+	stored.lastTitle.swap(block.lastTitle);
+	stored.numPages = block.numPages;
+
+	//Write all the blocks that are ready, in order
+	std::map<int64,ThreadedWriterBlock>::iterator it;
+	while((it = readyBlocks.find(nextBlockToWrite)) != readyBlocks.end())
+	{
+		outstream.write(it->second.text, it->second.text.GetLength());
+
+		numPagesWritten += it->second.numPages;
+		std::atomic_store(&lastPageTitle, std::shared_ptr<const BString>(new BString(it->second.lastTitle)));
+
+		readyBlocks.erase(it);
+		nextBlockToWrite++;
+	}
+
+	orderCondition.notify_all();
 }
 
 bool ThreadedWriter::IsRunning()
@@ -101,14 +175,18 @@ bool ThreadedWriter::IsRunning()
 
 void ThreadedWriter::GetCurStats(ThreadedWriterStats& stats)
 {
-	boost::recursive_mutex::scoped_lock lock(statMutex);
 	stats.numPagesWritten = numPagesWritten;
-	stats.lastPageTitle = lastPageTitle;
+
+	std::shared_ptr<const BString> title = std::atomic_load(&lastPageTitle);
+	if(title) stats.lastPageTitle = *title;
 }
 
 void ThreadedWriter::Stop()
 {
 	stopFlag = true;
+
+	boost::mutex::scoped_lock lock(orderMutex);
+	orderCondition.notify_all();
 }
 
 //Extracts article text from parsed mediaWiki in XML
@@ -125,10 +203,222 @@ void ThreadedWriter::WriteContentToString(const xml_node& node, BString& string)
 	buffer[numSymbols]=0;
 	string=buffer.arr;
 
-	DizzyUtility::ConvertHtmlEntities(string);
-	DizzyUtility::ReplaceStrangeDash(string);
-	string.Replace("\t\n","\n");
-	CommonUtility::LimitRuns(string,'\x0A',2);	//Remove runs greater than 2 LFs in a row
+	FinishText(string);
+}
+
+//Final processing of the rendered text
+//Html entities and dashes, tabs before LF, runs greater than 2 LFs in a row - all in one pass
+void ThreadedWriter::FinishText(BString& string)
+{
+	DizzyUtility::DecodeHtmlText(string, 2);
+}
+
+//Streaming version of WriteContentToString() for the stored XML of a page
+void ThreadedWriter::StreamContentToString(const BString& xml, BString& string, BString& title)
+{
+	StreamContentToString(xml, xml.GetLength(), string, title);
+}
+
+void ThreadedWriter::StreamContentToString(const char* xml, int64 length, BString& string, BString& title)
+{
+	XmlStreamTokenizer tok(xml, length);
+	string.clear();
+	string.reserve((size_t)(length/2));
+	title = "";
+
+	//Document level - only elements, text outside of the root element is not part of the document
+	XmlStreamTokenizer::TokenType type;
+	while((type = tok.Next()) != XmlStreamTokenizer::tokenEnd)
+	{
+		if(type != XmlStreamTokenizer::tokenStartTag) continue;
+
+		if(tok.NameIs("page")) StreamPage(tok, string, 0, title);
+		else StreamElement(tok, string, 0);
+	}
+
+	FinishText(string);
+}
+
+//Renders all children of the current element
+void ThreadedWriter::StreamChildren(XmlStreamTokenizer& tok, BString& out, size_t base)
+{
+	if(tok.fSelfClosing) return;
+
+	while(1)
+	{
+		XmlStreamTokenizer::TokenType type = tok.Next();
+		if(type == XmlStreamTokenizer::tokenEnd || type == XmlStreamTokenizer::tokenEndTag) return;
+
+		if(type == XmlStreamTokenizer::tokenText) out.append(tok.value, tok.valueLength);
+		else StreamElement(tok, out, base);
+	}
+}
+
+//Same rules as InternalWriteContent()
+void ThreadedWriter::StreamElement(XmlStreamTokenizer& tok, BString& out, size_t base)
+{
+	XmlTag tag = XmlTags::GetTag(tok.value, tok.valueLength);
+
+	if(tag == tagPage) {BString title; StreamPage(tok, out, base, title); return;}
+	if(tag == tagSection) {StreamSection(tok, out, base); return;}
+
+	//some element nodes are ignored completely
+	if(tag == tagTemplate || tag == tagInterwiki || tag == tagWTable || tag == tagMedia ||
+		tag == tagCategory || tag == tagStyle || tag == tagUrl || tag == tagTitle)
+	{
+		tok.SkipElement();
+		return;
+	}
+
+	//if it is a link, print the anchor text
+	if(tag == tagLink || tag == tagExtLink) {StreamLink(tok, out, base); return;}
+
+	//if it is an image, print the caption if we are including them
+	if(tag == tagFile)
+	{
+		if(fSkipImCaptions) tok.SkipElement();
+		else StreamFile(tok, out);
+		return;
+	}
+
+	bool fPar = (tag == tagPar);
+	bool fListEl = (tag == tagListEl);
+
+	if(fListEl) out += '\t';
+
+	StreamChildren(tok, out, base);
+
+	if((fPar || fListEl) && out.size() != base) out += "\n\n";
+}
+
+//Page header, then all children except url and title
+void ThreadedWriter::StreamPage(XmlStreamTokenizer& tok, BString& out, size_t base, BString& title)
+{
+	BString type, list;
+	tok.GetAttribute("type", type);
+	tok.GetAttribute("list", list);
+
+	bool fHeaderDone = false;
+	bool fEmpty = tok.fSelfClosing;
+	while(!fEmpty)
+	{
+		XmlStreamTokenizer::TokenType tokType = tok.Next();
+		if(tokType == XmlStreamTokenizer::tokenEnd || tokType == XmlStreamTokenizer::tokenEndTag) break;
+
+		//url and title come first and are not printed, the title goes into the header
+		if(!fHeaderDone && tokType == XmlStreamTokenizer::tokenStartTag && (tok.NameIs("url") || tok.NameIs("title")))
+		{
+			if(tok.NameIs("url") || tok.fSelfClosing) {tok.SkipElement(); continue;}
+
+			tokType = tok.Next();
+			if(tokType == XmlStreamTokenizer::tokenText) {title.assign(tok.value, tok.valueLength); tok.SkipToEndTag();}
+			else if(tokType == XmlStreamTokenizer::tokenStartTag) {tok.SkipElement(); tok.SkipToEndTag();}
+			continue;
+		}
+
+		if(!fHeaderDone)
+		{
+			out += PageHeader(title, type, list);
+			fHeaderDone = true;
+		}
+
+		if(tokType == XmlStreamTokenizer::tokenText) out.append(tok.value, tok.valueLength);
+		else StreamElement(tok, out, base);
+	}
+
+	if(!fHeaderDone) out += PageHeader(title, type, list);
+}
+
+//Section header with the title, then the content of the section
+void ThreadedWriter::StreamSection(XmlStreamTokenizer& tok, BString& out, size_t base)
+{
+	BString level;
+	tok.GetAttribute("level", level);
+
+	BString prefix;
+	if(fMarkSections) prefix = BString("\n\n#Subtitle level ") + level + ": ";
+	else prefix = "\n\n";
+
+	bool fHeaderDone = false;
+	bool fContentDone = false;
+	bool fEmpty = tok.fSelfClosing;
+	while(!fEmpty)
+	{
+		XmlStreamTokenizer::TokenType type = tok.Next();
+		if(type == XmlStreamTokenizer::tokenEnd || type == XmlStreamTokenizer::tokenEndTag) break;
+		if(type != XmlStreamTokenizer::tokenStartTag) continue;
+
+		if(!fHeaderDone && tok.NameIs("secTitle"))
+		{
+			out += prefix;
+			StreamElement(tok, out, out.size());	//The title is written on its own
+			out += "\n\n";
+			fHeaderDone = true;
+			continue;
+		}
+
+		if(!fContentDone && tok.NameIs("secContent"))
+		{
+			if(!fHeaderDone) {out += prefix + "\n\n"; fHeaderDone = true;}
+
+			StreamElement(tok, out, base);
+			fContentDone = true;
+			continue;
+		}
+
+		tok.SkipElement();
+	}
+
+	if(!fHeaderDone) out += prefix + "\n\n";
+}
+
+//Only the first anchor of a link is printed
+void ThreadedWriter::StreamLink(XmlStreamTokenizer& tok, BString& out, size_t base)
+{
+	bool fAnchorDone = false;
+	bool fEmpty = tok.fSelfClosing;
+	while(!fEmpty)
+	{
+		XmlStreamTokenizer::TokenType type = tok.Next();
+		if(type == XmlStreamTokenizer::tokenEnd || type == XmlStreamTokenizer::tokenEndTag) break;
+		if(type != XmlStreamTokenizer::tokenStartTag) continue;
+
+		if(!fAnchorDone && tok.NameIs("anchor"))
+		{
+			StreamElement(tok, out, base);
+			fAnchorDone = true;
+		}
+		else tok.SkipElement();
+	}
+}
+
+//Only the first caption of a file is printed, as a separate paragraph, and only if it is not empty
+void ThreadedWriter::StreamFile(XmlStreamTokenizer& tok, BString& out)
+{
+	bool fCaptionDone = false;
+	bool fEmpty = tok.fSelfClosing;
+	while(!fEmpty)
+	{
+		XmlStreamTokenizer::TokenType type = tok.Next();
+		if(type == XmlStreamTokenizer::tokenEnd || type == XmlStreamTokenizer::tokenEndTag) break;
+		if(type != XmlStreamTokenizer::tokenStartTag) continue;
+
+		if(!fCaptionDone && tok.NameIs("caption"))
+		{
+			size_t mark = out.size();
+			out += "\n\n";
+			if(fMarkCaptions) out += "#Caption: ";
+
+			size_t captionStart = out.size();
+			StreamElement(tok, out, captionStart);		//The caption is written on its own
+
+			if(out.size() == captionStart) out.resize(mark);	//Empty caption - nothing is printed
+			else out += "\n\n";
+
+			fCaptionDone = true;
+		}
+		else tok.SkipElement();
+	}
 }
 
 //Extracts article text from parsed mediaWiki in XML
@@ -145,32 +435,19 @@ void ThreadedWriter::InternalWriteContent(const xml_node& node, char* buffer, in
 
 	//if it is not an element node at this point, it is not printable
 	if(node.type()!=node_element && node.type()!=node_document) return;
-	BString name=node.name();
+	XmlTag tag=XmlTags::GetTag(node);
 
 	//If it is a page, write the title, type, and whether it's a list, unless we aren't marking articles
-	if(name=="page")
+	if(tag==tagPage)
 	{
-		BString title = node.child("title").first_child().value();
-
-		BString string;
-		if(fMarkArticles)
-		{
-			BString type = node.attribute("type").value();
-			if(type == "disambig") type = "disambiguation";
-			if(type == "article") type = "regular article";
-
-			BString list = node.attribute("list").value();
-			if(list == "yes") type = "list article";
-
-			string = BString("\n\n#Article: ") + title +
-							"\n#Type: " + type + "\n\n";
-		}
-		else string = BString("\n\n") + title + "\n\n";
+		BString string = PageHeader(node.child("title").first_child().value(),
+									node.attribute("type").value(),
+									node.attribute("list").value());
 
 		InsertIntoWriteBuffer(string,buffer,counter);
 	}
 
-	if(name == "section")
+	if(tag==tagSection)
 	{
 		BString subtitle;
 		WriteContentToString(node.child("secTitle"),subtitle);
@@ -190,14 +467,14 @@ void ThreadedWriter::InternalWriteContent(const xml_node& node, char* buffer, in
 	}
 
 	//some element nodes are ignored completely
-	if(name=="template" || name=="interwiki" || name=="wTable" || name=="media" || name=="category") return;
-	if(name=="style" || name=="url" || name=="title") return;
+	if(tag==tagTemplate || tag==tagInterwiki || tag==tagWTable || tag==tagMedia || tag==tagCategory) return;
+	if(tag==tagStyle || tag==tagUrl || tag==tagTitle) return;
 
 	//if it is a link, print the anchor text
-	if(name=="link" || name=="extLink") {InternalWriteContent(node.child("anchor"), buffer, counter);return;}
+	if(tag==tagLink || tag==tagExtLink) {InternalWriteContent(node.child("anchor"), buffer, counter);return;}
 
 	//if it is an image, print the caption if we are including them
-	if(name=="file")
+	if(tag==tagFile)
 	{
 		if(!fSkipImCaptions)
 		{
@@ -216,7 +493,7 @@ void ThreadedWriter::InternalWriteContent(const xml_node& node, char* buffer, in
 	}
 
 	//If it is a listEl, insert a tabulation before, a double LF after, and do nothing if it's empty
-	if(name=="listEl") InsertIntoWriteBuffer('\t',buffer,counter);
+	if(tag==tagListEl) InsertIntoWriteBuffer('\t',buffer,counter);
 
 	//all other types of nodes, iterate over the children
 	xml_node child=node.first_child();
@@ -227,12 +504,25 @@ void ThreadedWriter::InternalWriteContent(const xml_node& node, char* buffer, in
 	}
 
 	//If it was a par or a listEl, add a double LF, unless the buffer is empty
-	if(name=="par" || name=="listEl")
+	if(tag==tagPar || tag==tagListEl)
 	{
 		if(counter!=0) InsertIntoWriteBuffer("\n\n", buffer, counter);
 	}
 }
 
+//The header written before each page - title, type, and whether it's a list, unless we aren't marking articles
+BString ThreadedWriter::PageHeader(const BString& title, const BString& pageType, const BString& list)
+{
+	if(!fMarkArticles) return BString("\n\n") + title + "\n\n";
+
+	BString type = pageType;
+	if(type == "disambig") type = "disambiguation";
+	if(type == "article") type = "regular article";
+	if(list == "yes") type = "list article";
+
+	return BString("\n\n#Article: ") + title + "\n#Type: " + type + "\n\n";
+}
+
 //Private helper for content writer
 void ThreadedWriter::InsertIntoWriteBuffer(char symbol, char* buffer, int& counter)
 {
@@ -248,6 +538,14 @@ void ThreadedWriter::InsertIntoWriteBuffer(const BString& string, char* buffer,
 	counter+=length;
 }
 
+//Private helper for content writer
+void ThreadedWriter::InsertIntoWriteBuffer(const char* string, char* buffer, int& counter)
+{
+	int length = (int)strlen(string);
+	if(buffer!=NULL){memcpy(buffer+counter,string,length);}
+	counter+=length;
+}
+
 void ThreadedWriter::Report(std::ostream& stream)
 {
 	stream << "***Wiki Parser: converting parsed XML into plain text***\n\n";
@@ -257,9 +555,16 @@ void ThreadedWriter::Report(std::ostream& stream)
 	
 	int h, m, s;
 	CommonUtility::SecondsToHMS((int)timer.GetCurTime(0),h,m,s);
-	stream << "Processing took a total of: " << h << " hours, " << m << " minutes, " << s << " seconds.\n\n";
+	stream << "Processing took a total of: " << h << " hours, " << m << " minutes, " << s << " seconds.\n";
+	stream << "Number of writing threads used: " << numThreads << " threads.\n\n";
 
+	ReportSettings(stream);
+
+	stream << "Number of pages from the parsed XML written as plain text: " << numPagesWritten << ".\n";
+}
 
+void ThreadedWriter::ReportSettings(std::ostream& stream)
+{
 	stream << "The following settings were used during the conversion:\n";
 
 	if(fMarkArticles) stream << "\t\tMarking articles with #Article tags.\n";
@@ -278,6 +583,4 @@ void ThreadedWriter::Report(std::ostream& stream)
 	}
 
 	stream << "\n";
-
-	stream << "Number of pages from the parsed XML written as plain text: " << numPagesWritten << ".\n";
 }
\ No newline at end of file
@@ -27,6 +27,11 @@
 #include "Timer.h"
 
 #include "CAISFileFetcher.h"
+#include "XmlStreamTokenizer.h"
+#include <atomic>
+#include <memory>
+#include <map>
+#include <fstream>
 
 class ThreadedWriterStats
 {
@@ -39,6 +44,15 @@ public:
 	BString lastPageTitle;
 };
 
+//A block of consecutive pages rendered by one worker, waiting in the reorder buffer
+class ThreadedWriterBlock
+{
+public:
+	BString text;
+	BString lastTitle;
+	int numPages;
+};
+
 class ThreadedWriter
 {
 public:
@@ -53,27 +67,62 @@ public:
 	void Stop();
 	void GetCurStats(ThreadedWriterStats& stats);
 	void Report(std::ostream& stream);
+	void ReportSettings(std::ostream& stream);		//Only the write options, part of Report()
 
 	//Options
 	void SetSkipImCaptions(bool val){fSkipImCaptions = val;};
 	void SetMarkArticles(bool val){fMarkArticles = val;};
 	void SetMarkSections(bool val){fMarkSections = val;};
 	void SetMarkCaptions(bool val){fMarkCaptions = val;};
+	void SetNumThreads(int val){numThreads = val;};
 
 private:
-	void WorkerThread(	BString storageFile,
+	//Wrapper thread that launches the workers and waits for them to finish
+	void WrapperThread(	BString storageFile,
 						BString iiaFile,
 						BString outputFile);
 
-private:
+	//The workers share one reader, take blocks of blockSize pages in turn and render them
+	//The rendered blocks are written in page order through the reorder buffer
+	void WorkerThread(const CAISFileFetcher<char,int64>* cais);
+
+	//Places a rendered block into the reorder buffer and writes all blocks that are next in order
+	void SubmitBlock(int64 blockIndex, ThreadedWriterBlock& block);
+
+public:
 	//Extracts article text from parsed mediaWiki in XML
 	//Replaces html entities and "strange dash"
+	//Only reads the write options, so it can also be called by parser threads to render the pages they hold
 	void WriteContentToString(const pugi::xml_node& node, BString& string);
 
+	//Streaming version of WriteContentToString() for the stored XML of a page
+	//Renders the text in one pass over the XML string, without building a DOM
+	//Produces the same text as WriteContentToString() on the document loaded with StringToXml()
+	//Assumes the element order written by the parser: <url> and <title> first in <page>, <secTitle> before <secContent>
+	//title receives the page title
+	void StreamContentToString(const BString& xml, BString& string, BString& title);
+	void StreamContentToString(const char* xml, int64 length, BString& string, BString& title);
+
+private:
+	//Internal functions for the streaming renderer
+	//Each is called right after the start tag of its element is read and consumes the element up to its end tag
+	//base is the output position where the current content starts, for the "buffer is empty" checks
+	void StreamChildren(XmlStreamTokenizer& tok, BString& out, size_t base);
+	void StreamElement(XmlStreamTokenizer& tok, BString& out, size_t base);
+	void StreamPage(XmlStreamTokenizer& tok, BString& out, size_t base, BString& title);
+	void StreamSection(XmlStreamTokenizer& tok, BString& out, size_t base);
+	void StreamLink(XmlStreamTokenizer& tok, BString& out, size_t base);
+	void StreamFile(XmlStreamTokenizer& tok, BString& out);
+
+	//Final processing of the rendered text - html entities, dashes, LF runs
+	void FinishText(BString& string);
+
 	//Internal function for content writer
 	void InternalWriteContent(const pugi::xml_node& node, char* buffer, int& counter);
 	void InsertIntoWriteBuffer(char symbol, char* buffer, int& counter);	//Internal helper for content writer
 	void InsertIntoWriteBuffer(const BString& string, char* buffer, int& counter);		//Internal helper
+	void InsertIntoWriteBuffer(const char* string, char* buffer, int& counter);			//Internal helper
+	BString PageHeader(const BString& title, const BString& pageType, const BString& list);	//Header before each page
 
 private:
 	//Write options
@@ -83,12 +132,24 @@ private:
 	bool fMarkCaptions;
 
 private:
-	boost::recursive_mutex statMutex;
 	CTimer timer;
 	volatile bool stopFlag;
 	volatile bool fRunning;
-	int numPagesWritten;
-	BString lastPageTitle;
+	int numThreads;
+
+	//Progress stats, updated without locking
+	std::atomic<int> numPagesWritten;
+	std::shared_ptr<const BString> lastPageTitle;		//Accessed through std::atomic_load() and std::atomic_store()
+
+	//Reorder buffer - blocks are written to outstream strictly in the order of their index
+	std::ofstream outstream;
+	boost::mutex orderMutex;
+	boost::condition_variable orderCondition;
+	std::map<int64,ThreadedWriterBlock> readyBlocks;
+	int64 nextBlockToWrite;
+	std::atomic<int64> nextBlockToRender;
+	int64 blockSize;			//Number of pages in a block
+	int64 maxBlocksAhead;		//A worker waits if its block is this far ahead of the next block to write
 
 	BString startTimeString;
 };
\ No newline at end of file
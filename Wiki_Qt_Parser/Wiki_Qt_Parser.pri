@@ -9,6 +9,18 @@ message("You are running qmake on a generated .pro file. This may not work!")
 
 HEADERS += ../shared/CAISFileFetcher.h \
     ../shared/CAISSplitWriter.h \
+    ../shared/HtmlEntities.h \
+    ../shared/XmlStreamTokenizer.h \
+    ../shared/TreeVisitor.h \
+    ../shared/XmlTags.h \
+    ../shared/MappedFile.h \
+    ../shared/AsyncFileWriter.h \
+    ../shared/BlockCompressor.h \
+    ../shared/MappedArchive.h \
+    ../shared/StringHashIndex.h \
+    ../shared/StringPool.h \
+    ../shared/ThreadPool.h \
+    ../shared/ConcurrentBidirectionalMap.h \
     ./PageIndex.h \
     ./resource.h \
     ./ThreadedParser.h \
@@ -23,6 +35,16 @@ SOURCES += ../pugixml/src/pugixml.cpp \
     ../shared/Common.cpp \
     ../shared/CommonUtility.cpp \
     ../shared/DizzyUtility.cpp \
+    ../shared/HtmlEntities.cpp \
+    ../shared/TreeVisitor.cpp \
+    ../shared/XmlTags.cpp \
+    ../shared/MappedFile.cpp \
+    ../shared/AsyncFileWriter.cpp \
+    ../shared/BlockCompressor.cpp \
+    ../shared/MappedArchive.cpp \
+    ../shared/StringHashIndex.cpp \
+    ../shared/StringPool.cpp \
+    ../shared/ThreadPool.cpp \
     ../shared/QtUtils.cpp \
     ../shared/Savable.cpp \
     ../shared/SimplestXml.cpp \
@@ -26,6 +26,7 @@
 #include <sstream>
 #include "WordTrace.h"
 #include "DizzyUtility.h"
+#include "ThreadPool.h"
 
 #include "QtUtils.h"
 
@@ -41,8 +42,19 @@ errorMapGeneral(100,true),
 errorMapRedirects(100,true),
 errorMapTemplates(100,true),
 errorMapArtDisambigs(100,true),
-retainedTemplates(10)
+retainedTemplates(10),
+discardedSections(10)
 {
+	//Titles of sections that are discarded together with their subsections
+	//These are dropped based on the raw heading text, before the section is parsed
+	//The defaults are replaced by the list in the parser data, if it has one
+	discardedSections.AddWord(BString("References"));
+	discardedSections.AddWord(BString("External links"));
+	discardedSections.AddWord(BString("Bibliography"));
+	discardedSections.AddWord(BString("Footnotes"));
+	discardedSections.AddWord(BString("Further reading"));
+	discardedSections.AddWord(BString("Notes"));
+
 	//Read the parser data - it can either be in plain text files in a directory
 	//Or in a serialized file, in which case "parserFolder" is really a file name
 	if(!fEncodedFile) ReadPlainParserData(parserFolder);
@@ -53,6 +65,14 @@ retainedTemplates(10)
 	retainedTemplates.AddWord(BString("see also"));
 	retainedTemplates.AddWord(BString("aircontent"));
 
+	fPiecesParallel=false;
+	ClearStats();
+	SetPageTimeBudget(0);
+	SetParallelSections(1,0);
+	SetPassTiming(false);
+	SetTemplateCacheSize(10000);
+	StartPageBudget("");
+
 	//Tag names that are removed during initial cleanup
 	tagNamesForCleanup.ResizeArray(9);
 	tagNamesForCleanup << "ref"
@@ -99,6 +119,9 @@ void CWikipediaParser::Serialize(BArchive& archive)
 			& imExtensionMap
 			& infoImageMarkers
 			& infoCaptionMarkers;
+
+	//Added later - files saved without it end here, and the built-in list is kept
+	if(archive.IsStoring() || !archive.IsAtEnd()) archive & discardedSections;
 }
 
 void CWikipediaParser::ReadPlainParserData(const BString& folder)
@@ -122,6 +145,9 @@ void CWikipediaParser::ReadPlainParserData(const BString& folder)
 	temp.ReadStrings(folder+"Infobox caption params for parser.txt");
 	infoCaptionMarkers.CreateFromArray(temp);
 
+	//Titles of discarded sections, one per line - the built-in list is kept if there is no such file
+	if(temp.ReadStrings(folder+"Discarded sections.txt")) discardedSections.CreateFromArray(temp);
+
 	Save(folder+"pdata.cfg");
 }
 
@@ -171,7 +197,8 @@ void CWikipediaParser::TidyAndCleanNode(xml_node& node)
 
 			bool tidyRes=TidyAndClean(string,"Node-level cleanup: ");
 
-			if(!tidyRes)
+			//Recursive re-tidying is what makes pathological pages slow, it is not attempted over budget
+			if(!tidyRes && !IsOverBudget())
 			{
 				TidyAndCleanNode(curChild);
 				XmlToString(curChild,string);
@@ -180,10 +207,9 @@ void CWikipediaParser::TidyAndCleanNode(xml_node& node)
 
 			if(tidyRes)		//success, place the processed child before the current one
 			{
-				xml_document tempDoc;
-				StringToXml(tempDoc,string);
-				
-				node.insert_copy_before(tempDoc.first_child(),curChild);
+				//Appended to the current child, in the same document, and moved out of it
+				xml_node cleaned=AppendParsed(curChild,string);
+				if(cleaned) node.insert_move_before(cleaned,curChild);
 			}
 
 			node.remove_child(curChild);	//remove the old node
@@ -191,35 +217,170 @@ void CWikipediaParser::TidyAndCleanNode(xml_node& node)
 	}
 }
 
-//Looks for one of the disambiguation templates
-//In the tree structure and returns true if found
-//otherwise false
-bool CWikipediaParser::IsDisambiguationPage(xml_node& node)
+//Sets the page type and runs the postprocessing on a parsed page
+//Traversal 1 only reads the tree: disambiguation and list templates
+//RemoveLeadingLists() only looks at <firstPara> and runs on its own
+//Traversal 2 does, on each node and in this order: <gallery> tags, special templates, node removal,
+//and, when leaving <firstPara> or the content of a section, moves the images to its end
+void CWikipediaParser::PostProcessPage(xml_document& doc)
 {
-	BString target;
+	xml_node pageNode=doc.child("page");
 
-	xml_node child=node.first_child();
-	while(child)
+	bool fDisambig=false;
+	bool fList=IsListTitle(pageNode.child("title").first_child().value());
+
+	CTreeVisitor classify;
+	classify.SetTiming(fPassTiming);
+	classify.AddPass("Disambiguation templates",std::bind(&CWikipediaParser::DisambigTemplateVisit,this,std::placeholders::_1,std::ref(fDisambig)));
+	if(!fList) classify.AddPass("List templates",std::bind(&CWikipediaParser::ListTemplateVisit,this,std::placeholders::_1,std::ref(fList)));
+	classify.Run(doc);
+
+	//Set page type in XML
+	if(fDisambig) pageNode.append_attribute("type").set_value("disambig");
+	else pageNode.append_attribute("type").set_value("article");
+
+	//Disambiguation pages are not considered list pages
+	if(fList) pageNode.append_attribute("list").set_value("yes");
+
+	//Postprocessing
+	RemoveLeadingLists(doc);
+
+	CTreeVisitor process;
+	process.SetTiming(fPassTiming);
+	process.AddPass("Gallery tags",std::bind(&CWikipediaParser::GalleryTagVisit,this,std::placeholders::_1));
+	process.AddPass("Special templates",std::bind(&CWikipediaParser::SpecialTemplateVisit,this,std::placeholders::_1));
+	process.AddPass("Node removal",std::bind(&CWikipediaParser::ConditionalRemoveVisit,this,std::placeholders::_1));
+	process.AddPass("Images to end of sections",CTreeVisitor::VisitHandler(),std::bind(&CWikipediaParser::MoveImagesLeave,this,std::placeholders::_1));
+	process.Run(doc);
+
+	if(fPassTiming)
 	{
-		if(child.type()==node_element)
-		{
-			if(BString(child.name())=="template")
-			{
-				target=child.child("target").first_child().value();
-				target.MakeLower();
+		AddPassTimes(classify);
+		AddPassTimes(process);
+	}
+}
 
-				if(disambigTargets.IsPresent(target)) return true;
-			}
-			else
-			{
-				if(IsDisambiguationPage(child)) return true;
-			}
-		}
+CTreeVisitor::VisitResult CWikipediaParser::DisambigTemplateVisit(xml_node& node, bool& fFound)
+{
+	if(XmlTags::GetTag(node)!=tagTemplate) return CTreeVisitor::visitContinue;
 
-		child=child.next_sibling();
+	BString target=node.child("target").first_child().value();
+	target.MakeLower();
+
+	if(!disambigTargets.IsPresent(target)) return CTreeVisitor::visitSkipChildren;
+
+	fFound=true;
+	return CTreeVisitor::visitStop;
+}
+
+CTreeVisitor::VisitResult CWikipediaParser::ListTemplateVisit(xml_node& node, bool& fFound)
+{
+	if(XmlTags::GetTag(node)!=tagTemplate) return CTreeVisitor::visitContinue;
+
+	BString name=node.child("target").first_child().value();
+	name.MakeLower();
+
+	if(IsListTemplate(name))
+	{
+		fFound=true;
+		return CTreeVisitor::visitStop;
 	}
 
-	return false;
+	return CTreeVisitor::visitContinue;
+}
+
+bool CWikipediaParser::IsListTemplate(const BString& name)
+{
+	return name=="set index" || name=="sia" || name=="set index article" ||
+		name=="months" || name=="yearbox" || name=="events by month links" ||
+		name.Left(9)=="years in ";
+}
+
+//Converts <gallery> tags to gallery templates
+//If the tag is still there, this is due to parse error - remove it
+CTreeVisitor::VisitResult CWikipediaParser::GalleryTagVisit(xml_node& node)
+{
+	XmlTag tag=XmlTags::GetTag(node);
+
+	//Special templates copy their content in front of them before the children are visited,
+	//so the galleries in a template are all converted when the template is visited
+	if(tag==tagTemplate)
+	{
+		CHArray<xml_node> galleries(10);
+		GetNodesByName(node,"gallery",galleries);
+		for(int i=0;i<galleries.Count();i++) GalleryTagToTemplate(galleries[i]);
+
+		int numRemoved=0;
+		RemoveChildrenByName(node,"gallery",numRemoved);
+		return CTreeVisitor::visitSkipChildren;
+	}
+
+	if(tag!=tagGallery) return CTreeVisitor::visitContinue;
+
+	GalleryTagToTemplate(node);
+
+	if(XmlTags::GetTag(node)==tagGallery) return CTreeVisitor::visitRemove;
+	return CTreeVisitor::visitContinue;
+}
+
+//The content of a special template is placed in front of it, so its children are not visited
+CTreeVisitor::VisitResult CWikipediaParser::SpecialTemplateVisit(xml_node& node)
+{
+	if(XmlTags::GetTag(node)==tagTemplate && ProcessSpecialTemplate(node)) return CTreeVisitor::visitSkipChildren;
+	return CTreeVisitor::visitContinue;
+}
+
+//Removes nodes for interwiki links and categories
+//Removes templates, except those listed in retainedTemplates
+CTreeVisitor::VisitResult CWikipediaParser::ConditionalRemoveVisit(xml_node& node)
+{
+	XmlTag tag=XmlTags::GetTag(node);
+
+	//remove nodes based on name
+	if(tag==tagInterwiki || tag==tagCategory || tag==tagWTable || tag==tagDiv) return CTreeVisitor::visitRemove;
+
+	//Remove all templates, except those specified in retainedTemplates
+	//and infobox templates
+	if(tag==tagTemplate)
+	{
+		BString target=node.child("target").first_child().value();
+		target.MakeLower();
+		if( ! retainedTemplates.IsPresent(target) && target.Left(7)!="infobox") return CTreeVisitor::visitRemove;
+	}
+
+	//remove nodes based on section name
+	//Most such sections are skipped in ParseArticle already, this catches titles with markup in them
+	if(tag==tagSection)
+	{
+		BString secTitle=node.child("secTitle").first_child().value();
+		if(discardedSections.IsPresent(secTitle)) return CTreeVisitor::visitRemove;
+	}
+
+	return CTreeVisitor::visitContinue;
+}
+
+//Places all images in <firstPara> and in each section after the last text paragraph or list
+//Called after the content is processed, does nothing with the text in subsections
+void CWikipediaParser::MoveImagesLeave(xml_node& node)
+{
+	XmlTag tag=XmlTags::GetTag(node);
+	if(tag==tagFirstPara || (tag==tagSecContent && XmlTags::GetTag(node.parent())==tagSection)) MoveImagesToEnd(node);
+}
+
+void CWikipediaParser::AddPassTimes(CTreeVisitor& visitor)
+{
+	for(int i=0;i<visitor.NumPasses();i++) AddPassTime(visitor.PassName(i),visitor.PassSeconds(i));
+}
+
+void CWikipediaParser::AddPassTime(const BString& name, double seconds)
+{
+	for(int i=0;i<passTimeNames.Count();i++)
+	{
+		if(passTimeNames[i]==name) {passTimeSeconds[i]+=seconds;return;}
+	}
+
+	passTimeNames.AddAndExtend(name);
+	passTimeSeconds.AddAndExtend(seconds);
 }
 
 
@@ -431,7 +592,7 @@ void CWikipediaParser::ProcessBoldItalic(BString& text)
 }
 
 //Parses a section selected by ParseArticle
-bool CWikipediaParser::ParseSection(const BString& theSection, xml_document& output, bool fAlreadyCleaned)
+bool CWikipediaParser::ParseSection(const BString& theSection, xml_node& parent, bool fAlreadyCleaned)
 {
 	BString text=theSection;
 
@@ -530,8 +691,10 @@ bool CWikipediaParser::ParseSection(const BString& theSection, xml_document& out
 	text=newText.arr;
 
 	//Step 3: parse all templates - extract their names and parameters
+	//text is thrown away after each parse, so doc is parsed in place in docBuffer and text is reused for the output
+	BString docBuffer;
 	xml_document doc;
-	if(!StringToXml(doc,text))
+	if(!StringToXmlInPlace(doc,text,docBuffer))
 	{
 		AddError("Critical section error: XML parsing error after template/link delimiting.");
 		return false;
@@ -543,7 +706,7 @@ bool CWikipediaParser::ParseSection(const BString& theSection, xml_document& out
 	ProcessBoldItalic(text);
 	textLength=text.GetLength();
 
-	if(!StringToXml(doc,text))
+	if(!StringToXmlInPlace(doc,text,docBuffer))
 	{
 		AddError("Critical section error: XML parsing error after bold/italic delimiting.");
 		return false;
@@ -570,8 +733,9 @@ bool CWikipediaParser::ParseSection(const BString& theSection, xml_document& out
 
 	//At this point, all content is within unnested <par> tags
 
-	//Convert back to XML
-	if(!StringToXml(output,text))
+	//Convert back to XML, straight into parent
+	xml_node secNode=AppendParsed(parent,text);
+	if(!secNode)
 	{
 		AddError("Critical section error: parse error after inserting <par> tags.");
 		return false;
@@ -583,13 +747,12 @@ bool CWikipediaParser::ParseSection(const BString& theSection, xml_document& out
 	//Attempts to clean each element node, and deletes it on failure
 	if(!fAlreadyCleaned)
 	{
-        xml_node temp = output.first_child();
-        TidyAndCleanNode(temp);
+        TidyAndCleanNode(secNode);
 		fAlreadyCleaned=true;
 	}
 
 	//Step 6: for every paragraph, insert list element tags
-	xml_node curPar=output.first_child().child("par");
+	xml_node curPar=secNode.child("par");
 	while(curPar)
 	{
 		InsertListElInParagraph(curPar);
@@ -597,7 +760,7 @@ bool CWikipediaParser::ParseSection(const BString& theSection, xml_document& out
 	}
 
 	//Move all lists out of <par> and into <list>
-	MoveListElToLists(output);
+	MoveListElToLists(secNode);
 
 	return true;
 }
@@ -666,15 +829,16 @@ bool CWikipediaParser::InsertListElInParagraph(xml_node& parNode)
 	textLength=text.GetLength();
 
 	//Try parsing the text with the inserted <listEl> tags
-	xml_document doc;
-	if(!StringToXml(doc,text))
+	//It is parsed into parNode itself, as a <par> child, and its content is moved up
+	xml_node temp=AppendParsed(parNode,text);
+	if(!temp)
 	{
 		AddError("Critical paragraph error: XML parsing error after inserting <listEl> tags.");
 		return false;
 	}
 
-    xml_node temp = doc.first_child();
-    CopyChildrenToNode(temp,parNode);
+	MoveChildrenToNode(temp,parNode);
+	parNode.remove_child(temp);
 	return true;
 }
 
@@ -696,9 +860,9 @@ void CWikipediaParser::RemoveLFfromChildElements(xml_node& node)
 			int numRemoved=string.Remove('\x0A');
 			if(numRemoved>0)
 			{
-				xml_document tempDoc;
-				StringToXml(tempDoc,string);
-				node.insert_copy_before(tempDoc.first_child(),curChild);
+				//Appended to the current child, in the same document, and moved out of it
+				xml_node replacement=AppendParsed(curChild,string);
+				if(replacement) node.insert_move_before(replacement,curChild);
 				node.remove_child(curChild);
 			}
 		}
@@ -745,10 +909,9 @@ void CWikipediaParser::CreateElementOutsideMarkup(xml_document& doc, CHArray<cha
 //For a section, ensure that lists are in section-level <list> elements
 //Renames paragraphs with listEls into <list> elements
 //Non-recursive, operates on top-level paragraphs only (all paragraphs are top-level in the section)
-void CWikipediaParser::MoveListElToLists(xml_document& section)
+void CWikipediaParser::MoveListElToLists(xml_node& secNode)
 {
 	//the root node is <firstPara>, <secTitle> or <secContent>, and there are only paragraphs inside of them
-	xml_node secNode=section.first_child();
 	xml_node curPara=secNode.first_child();
 	xml_node curElement;	//current element in the paragraph, can be a <listEl> or something else
 
@@ -784,10 +947,9 @@ void CWikipediaParser::MoveListElToLists(xml_document& section)
 				//and move all remaining elements into it
 				while(curElement)
 				{
-					newPara.append_copy(curElement);
 					remNode=curElement;
 					curElement=curElement.next_sibling();
-					curPara.remove_child(remNode);
+					newPara.append_move(remNode);
 				}
 			}
 		}
@@ -810,6 +972,12 @@ bool CWikipediaParser::IsListSymbol(char symbol)
 //Error prefix is used in reporting the errors - can be anything
 bool CWikipediaParser::TidyAndClean(BString& text, const BString& errorPrefix)
 {
+	if(IsOverBudget())
+	{
+		AddError(errorPrefix+"skipped, page over time budget.");
+		return false;
+	}
+
 	BString textCopy=text;
 	textCopy="<wrap>"+textCopy+"</wrap>";
 
@@ -856,8 +1024,9 @@ bool CWikipediaParser::TidyAndClean(BString& text, const BString& errorPrefix)
 	textCopy.Remove('\x0D');
 
 	//Create pugi XML document
+	BString docBuffer;
 	xml_document tempDoc;
-	if(!StringToXml(tempDoc,textCopy))
+	if(!StringToXmlInPlace(tempDoc,textCopy,docBuffer))
 	{
 		AddError(errorPrefix+"HTML tidy output could not be parsed by pugi.");
 		return false;
@@ -895,8 +1064,9 @@ bool CWikipediaParser::ParseArticle(BString& page, xml_document& output)
 	page.Replace("__NOTOC__","");
 	page.Replace("__TOC__","");
 
-	//Create an XML document for the page and add title
-	xml_document doc;
+	//The page is built directly in the output document, so that parts of it can be moved rather than copied
+	//On failure, output may hold a partially built page
+	xml_document& doc=output;
 	doc.append_child("page");
 
 	//Set the current error map to the GeneralMap
@@ -915,6 +1085,7 @@ bool CWikipediaParser::ParseArticle(BString& page, xml_document& output)
 
 	BString url=page.Mid(pos1+7,pos2-pos1-7);	//extract page url
 	BString title=url;							//title is just another copy of the url - legacy code
+	StartPageBudget(url);
 
 	//Put url and title into the page XML
 	doc.child("page").append_child("url").append_child(node_pcdata).set_value(url);
@@ -925,7 +1096,6 @@ bool CWikipediaParser::ParseArticle(BString& page, xml_document& output)
 	int nSpace=GetNamespace(page);
 	if(nSpace==-10)	//error extracting namespace
 	{
-		CopyChildrenToNode(doc,output);
 		return false;
 	}
 
@@ -944,7 +1114,6 @@ bool CWikipediaParser::ParseArticle(BString& page, xml_document& output)
 	if(pageType=="other")
 	{
 		doc.child("page").append_attribute("type").set_value(pageType);
-		CopyChildrenToNode(doc,output);
 		return true;
 	}
 
@@ -956,7 +1125,6 @@ bool CWikipediaParser::ParseArticle(BString& page, xml_document& output)
 	if(pos1==-1 || pos2==-1)
 	{
 		AddError("Critical page error: no <text> or </text> tags.");
-		CopyChildrenToNode(doc,output);
 		return false;
 	}
 	
@@ -969,26 +1137,7 @@ bool CWikipediaParser::ParseArticle(BString& page, xml_document& output)
 	textLower.MakeLower();
 	if( nSpace==0 && textLower.Find("#redirect")!=-1 )
 	{
-		//Set the correct error map
-		curErrorMap=&errorMapRedirects;
-		AddError("Redirect parse started.");
-
-		pageType="redirect";
-		doc.child("page").append_attribute("type").set_value(pageType);
-
-		//Remove the # to avoid parsing it as a list element
-		text.Remove('#');
-
-		//Wrap the text and parse it as if it was a section
-		text="<text>"+text+"</text>";
-		xml_document parsed;
-		bool fSuccess=ParseSection(text,parsed,true);
-				
-		BString redirectTarget=GetNodeByName(parsed,"link").child("target").first_child().value();
-		if(!fSuccess || redirectTarget=="") {AddError("Could not parse a redirect page.");return false;}
-	
-		doc.child("page").append_attribute("target").set_value(redirectTarget);
-		CopyChildrenToNode(doc,output);
+		if(!ParseRedirect(text,doc)) return false;
 		return true;
 	}
 
@@ -1028,12 +1177,10 @@ bool CWikipediaParser::ParseArticle(BString& page, xml_document& output)
 
 		//Wrap the text and parse it as if it was a section
 		text="<text>"+text+"</text>";
-		xml_document parsed;
-		if(!ParseSection(text,parsed,true)){AddError("Could not parse a template page.");return false;}
+		xml_node pageNode=doc.child("page");
+		if(!ParseSection(text,pageNode,true)){AddError("Could not parse a template page.");return false;}
 
-		doc.child("page").append_attribute("type").set_value(pageType);
-		doc.child("page").append_copy(parsed.first_child());
-		CopyChildrenToNode(doc,output);
+		pageNode.append_attribute("type").set_value(pageType);
 		return true;
 	}
 
@@ -1090,21 +1237,103 @@ bool CWikipediaParser::ParseArticle(BString& page, xml_document& output)
 	//Append text node
 	xml_node textNode=doc.child("page").append_child("text");
 
-	//Call ParseSection on each section heading and section text
+	//Collect the pieces that are parsed with ParseSection
+	//pieces[2*i] is the title and pieces[2*i+1] is the text of run i, section 0 (first paragraph) has no title
+	//Empty pieces are not parsed
+	//Sections listed in discardedSections are skipped with all their subsections and have no pieces
+	int numPieces=2*(numSections+1);
+	CHArray<BString> pieces(numPieces,true);
+	CHArray<char> fSectionSkipped(numSections+1,true);
+	fSectionSkipped=0;
+
+	int skipLevel=0;		//level of the section being skipped, 0 if none
 	for(int i=0;i<(numSections+1);i++)
 	{
-		BString curString;
-		xml_document parsed;
-
 		if(i==0)	//if it is the first paragraph
 		{
 			int secLength=breaks[1]-breaks[0];
-			if(secLength>0)
+			if(secLength>0) pieces[1]="<firstPara>"+text.Mid(breaks[0],breaks[1]-breaks[0])+"</firstPara>";
+			continue;
+		}
+
+		//Subsections of a discarded section are discarded as well
+		if(skipLevel>0 && hLevel[i-1]>skipLevel)
+		{
+			fSectionSkipped[i]=1;
+			numSkippedSections++;
+			skippedSectionBytes+=breaks[2*i+1]-breaks[2*i-1];
+			continue;
+		}
+		skipLevel=0;
+
+		int secLength=hEnd[i-1]-hBeginMap[i-1]-hLevel[i-1]-1;
+		if(secLength>0)
+		{
+			BString curTitleString=text.Mid(hBeginMap[i-1]+hLevel[i-1]+1,secLength);
+			curTitleString.Trim();
+
+			if(discardedSections.IsPresent(curTitleString))
 			{
-				curString="<firstPara>"+text.Mid(breaks[0],breaks[1]-breaks[0])+"</firstPara>";
-				if(ParseSection(curString,parsed,fCleaned))
+				skipLevel=hLevel[i-1];
+				fSectionSkipped[i]=1;
+				numSkippedSections++;
+				skippedSectionBytes+=breaks[2*i+1]-breaks[2*i-1];
+				AddError("Section skipped by title before parsing.");
+				continue;
+			}
+
+			pieces[2*i]="<secTitle>"+curTitleString+"</secTitle>";
+		}
+
+		secLength=breaks[2*i+1]-breaks[2*i];
+		if(secLength>0) pieces[2*i+1]="<secContent>"+text.Mid(breaks[2*i]-1,secLength+1)+"</secContent>";		//-1, +1 to capture the leading LF of the section
+	}
+
+	//Call ParseSection on each piece
+	//Small pages are parsed sequentially in this thread, straight into a holder node in doc, and the pieces are moved into place
+	//Large pages are parsed by several threads, each piece in its own document, and the pieces are copied into place
+	bool fParallel=(sectionThreads>1 && textLength>=parallelPageSize && numSections>0);
+
+	CHArray<xml_document> pieceDocs(fParallel ? numPieces : 0,true);
+	CHArray<xml_node> targets(numPieces,true);
+	xml_node holder;
+	if(fParallel) {for(int i=0;i<numPieces;i++) targets[i]=pieceDocs[i];}
+	else {holder=doc.append_child("pieces");targets=holder;}
+
+	CHArray<xml_node> parsed(numPieces,true);	//root node of each parsed piece
+	CHArray<char> results(numPieces,true);		//1 - parsed, -1 - critical section error, 0 - not parsed
+	results=0;
+
+	ParseSectionPieces(pieces,targets,parsed,results,fCleaned,fParallel);
+
+	if(fOverBudget && fAbortOverBudget) {AddError("Critical page error: page aborted, over time budget.");return false;}
+
+	//Moves a piece that is already in doc, copies a piece from its own document
+	auto PlacePiece=[fParallel](xml_node& parent, xml_node& piece)
+	{
+		if(fParallel) parent.append_copy(piece);
+		else parent.append_move(piece);
+	};
+
+	//Put the parsed pieces into the document in order
+	for(int i=0;i<(numSections+1);i++)
+	{
+		if(fSectionSkipped[i]) continue;
+
+		//Remaining sections are dropped when the page ran over the time budget
+		if((pieces[2*i]!="" && results[2*i]==0) || (pieces[2*i+1]!="" && results[2*i+1]==0))
+		{
+			AddError("Sections discarded, page over time budget.");
+			break;
+		}
+
+		if(i==0)	//if it is the first paragraph
+		{
+			if(pieces[1]!="")
+			{
+				if(results[1]==1)
 				{
-					textNode.append_copy(parsed.first_child());
+					PlacePiece(textNode,parsed[1]);
 					AddError("Section 0 parsed successfully.");
 				}
 				else
@@ -1119,23 +1348,18 @@ bool CWikipediaParser::ParseArticle(BString& page, xml_document& output)
 			xml_attribute attr=secNode.append_attribute("level");
 			attr.set_value(hLevel[i-1]);
 
-			int secLength=hEnd[i-1]-hBeginMap[i-1]-hLevel[i-1]-1;
-			if(secLength>0)
+			if(pieces[2*i]!="")
 			{
-				BString curTitleString=text.Mid(hBeginMap[i-1]+hLevel[i-1]+1,secLength);
-				curTitleString.Trim();
-
-				curString="<secTitle>"+curTitleString+"</secTitle>";
-				if(ParseSection(curString,parsed,fCleaned))
+				if(results[2*i]==1)
 				{
 					//Move all the children out of the <par> node in <secTitle>
-                    xml_node temp1 = parsed.first_child().first_child();
-                    xml_node temp2 = parsed.first_child();
-                    CopyChildrenToNode(temp1,temp2);
+					xml_node temp1 = parsed[2*i].first_child();
+					xml_node temp2 = parsed[2*i];
+					MoveChildrenToNode(temp1,temp2);
 
-					parsed.first_child().remove_child(parsed.first_child().first_child());
+					temp2.remove_child(temp1);
 					//Put the secTitle into the document structure
-					secNode.append_copy(parsed.first_child());
+					PlacePiece(secNode,parsed[2*i]);
 				}
 				else
 				{
@@ -1143,13 +1367,11 @@ bool CWikipediaParser::ParseArticle(BString& page, xml_document& output)
 				}
 			}
 
-			secLength=breaks[2*i+1]-breaks[2*i];
-			if(secLength>0)
+			if(pieces[2*i+1]!="")
 			{
-				curString="<secContent>"+text.Mid(breaks[2*i]-1,secLength+1)+"</secContent>";		//-1, +1 to capture the leading LF of the section
-				if(ParseSection(curString,parsed,fCleaned))
+				if(results[2*i+1]==1)
 				{
-					secNode.append_copy(parsed.first_child());
+					PlacePiece(secNode,parsed[2*i+1]);
 					AddError("Section (not 0) parsed successfully.");
 				}
 				else
@@ -1160,6 +1382,9 @@ bool CWikipediaParser::ParseArticle(BString& page, xml_document& output)
 		}
 	}
 
+	//Pieces that were not placed go with the holder
+	if(holder) doc.remove_child(holder);
+
 	//Create the correct tree out of sections
 	xml_node rootNode=doc.first_child().child("text");
 	xml_node secNode=rootNode.first_child();
@@ -1182,11 +1407,10 @@ bool CWikipediaParser::ParseArticle(BString& page, xml_document& output)
 
 			if(!lastNodes.IsEmpty())	//this section gets attached to content of another section
 			{
-				xml_node newNode=lastNodes[lastNodes.GetNumPoints()-1].child("secContent").append_copy(secNode);
-				lastNodes.Push(newNode);
-				xml_node del=secNode;
+				xml_node curNode=secNode;
 				secNode=secNode.next_sibling();
-				rootNode.remove_child(del);
+				lastNodes[lastNodes.GetNumPoints()-1].child("secContent").append_move(curNode);
+				lastNodes.Push(curNode);
 			}
 			else			//This section remains in the root node
 			{
@@ -1200,46 +1424,294 @@ bool CWikipediaParser::ParseArticle(BString& page, xml_document& output)
 		}
 	}
 
-	//Check if this is a disambiguation or an article and set page type in XML
-	if(IsDisambiguationPage(doc)) pageType="disambig";
-	else pageType="article";
-	doc.child("page").append_attribute("type").set_value(pageType);
+	PostProcessPage(doc);
 
-	//Check whether this is a list page
-	//Disambiguation pages are not considered list pages
-	if(IsListPage(doc))
+	return true;
+}
+
+//Parses the section pieces collected by ParseArticle, results[i] is set to 1 on success and -1 on failure
+//Empty pieces and pieces that are not reached within the time budget are left with results[i]=0
+void CWikipediaParser::ParseSectionPieces(CHArray<BString>& pieces, CHArray<xml_node>& targets, CHArray<xml_node>& parsed,
+											CHArray<char>& results, bool fCleaned, bool fParallel)
+{
+	int nextPiece=0;
+
+	if(!fParallel)
 	{
-		doc.child("page").append_attribute("list").set_value("yes");
+		ParseSectionPiecesThread(pieces,targets,parsed,results,fCleaned,nextPiece);
+		return;
 	}
 
-	//Postprocessing
-	CopyChildrenToNode(doc,output);
+	AddError("Sections parsed in parallel.");
 
-	RemoveLeadingLists(output);
-	ProcessGalleryTags(output);
-	ProcessSpecialTemplates(output);
-	ConditionalRemoveNodes1(output);
-	MoveImagesToEndOfSections(output);
+	//The jobs run on the shared pool, with this thread taking part,
+	//so the number of threads stays bounded however many parsers do this at once
+	fPiecesParallel=true;
+	CThreadPool::Run(sectionThreads,[&](int)
+	{
+		ParseSectionPiecesThread(pieces,targets,parsed,results,fCleaned,nextPiece);
+	});
+	fPiecesParallel=false;
+}
 
+//Worker for ParseSectionPieces(), takes the pieces in order until there are none left
+void CWikipediaParser::ParseSectionPiecesThread(CHArray<BString>& pieces, CHArray<xml_node>& targets, CHArray<xml_node>& parsed,
+												CHArray<char>& results, bool fCleaned, int& nextPiece)
+{
+	while(1)
+	{
+		int curPiece;
+		{
+			boost::unique_lock<boost::recursive_mutex> lock(mutex,boost::defer_lock);
+			if(fPiecesParallel) lock.lock();
+			curPiece=nextPiece++;
+		}
+		if(curPiece>=pieces.Count()) break;
+
+		if(pieces[curPiece]=="" || IsOverBudget()) continue;
+
+		if(ParseSection(pieces[curPiece],targets[curPiece],fCleaned))
+		{
+			results[curPiece]=1;
+			parsed[curPiece]=targets[curPiece].last_child();
+		}
+		else results[curPiece]=-1;
+	}
+}
+
+//Checks the budget for the current page, logs the page the first time it goes over
+bool CWikipediaParser::IsOverBudget()
+{
+	boost::unique_lock<boost::recursive_mutex> lock(mutex,boost::defer_lock);
+	if(fPiecesParallel) lock.lock();
+
+	if(fOverBudget) return true;
+	if(pageTimeBudget<=0 || timer.GetCurTime(0)<pageTimeBudget) return false;
+
+	fOverBudget=true;
+	overBudgetTitles.AddAndExtend(curPageTitle);
+	AddError("Page over time budget.");
 	return true;
 }
 
-//Converts all <gallery> tags to gallery templates
-void CWikipediaParser::ProcessGalleryTags(xml_node& node)
+//Parses a redirect page text and sets the type and target attributes on the <page> node in doc
+bool CWikipediaParser::ParseRedirect(BString& text, xml_document& doc)
 {
-	//Find galleries
-	CHArray<xml_node> galleries(10);
-	GetNodesByName(node,"gallery",galleries);
+	//Set the correct error map
+	curErrorMap=&errorMapRedirects;
+	AddError("Redirect parse started.");
 
-	//This will convert the gallery tags to Template:Gallery
-	//And call TemplateGallery() on them
-	//Will delete the <gallery> nodes on failure
-	for(int i=0;i<galleries.Count();i++) GalleryTagToTemplate(galleries[i]);
+	doc.child("page").append_attribute("type").set_value("redirect");
 
-	//If some gallery tags remain, this is due to parse error
-	//remove them
-	int numRemoved=0;
-	RemoveChildrenByName(node,"gallery",numRemoved);
+	//Remove the # to avoid parsing it as a list element
+	text.Remove('#');
+
+	//Wrap the text and parse it as if it was a section
+	text="<text>"+text+"</text>";
+	xml_document parsed;
+	bool fSuccess=ParseSection(text,parsed,true);
+			
+	BString redirectTarget=GetNodeByName(parsed,"link").child("target").first_child().value();
+	if(!fSuccess || redirectTarget=="") {AddError("Could not parse a redirect page.");return false;}
+
+	doc.child("page").append_attribute("target").set_value(redirectTarget);
+	return true;
+}
+
+bool CWikipediaParser::ExtractInfoboxes(BString& page, xml_document& output)
+{
+	//Same preprocessing as in ParseArticle
+	page.Replace("&amp;nbsp;"," ");
+	page.Replace("&amp;","&");
+
+	//Built directly in the output document, as in ParseArticle
+	xml_document& doc=output;
+	xml_node pageNode=doc.append_child("page");
+
+	curErrorMap=&errorMapGeneral;
+	AddError("Infobox extraction started.");
+
+	//Extract title
+	int pos1, pos2=-1;
+	pos1=page.Find("<title>",0);
+	if(pos1>=0) pos2=page.Find("</title>",pos1);
+	if(pos1==-1 || pos2==-1)
+	{
+		AddError("Critical page error: no <title> or </title> tags.");
+		return false;
+	}
+
+	BString url=page.Mid(pos1+7,pos2-pos1-7);
+	StartPageBudget(url);
+	pageNode.append_child("url").append_child(node_pcdata).set_value(url);
+	pageNode.append_child("title").append_child(node_pcdata).set_value(url);
+
+	//Only articles (namespace 0) are of interest, templates are not parsed in this mode
+	int nSpace=GetNamespace(page);
+	if(nSpace==-10)
+	{
+		return false;
+	}
+
+	if(nSpace!=0)
+	{
+		pageNode.append_attribute("type").set_value("other");
+		return true;
+	}
+
+	//Extract text without any tags
+	pos1=page.Find("<text",0);
+	if(pos1>=0) pos2=page.Find("</text>",pos1);
+	if(pos1==-1 || pos2==-1)
+	{
+		AddError("Critical page error: no <text> or </text> tags.");
+		return false;
+	}
+	
+	pos1=page.Find(">",pos1);pos1++;
+	BString text="\n"+page.Mid(pos1,pos2-pos1);
+
+	//Redirects are needed for the page index
+	BString textLower=text;
+	textLower.MakeLower();
+	if(textLower.Find("#redirect")!=-1)
+	{
+		if(!ParseRedirect(text,doc)) return false;
+		return true;
+	}
+
+	curErrorMap=&errorMapArtDisambigs;
+
+	HandleCRLF(text);
+	common.RemoveBracketedByStrings(text,"&lt;!--","--&gt;");
+
+	//The page type is set from the top-level templates, as in PostProcessPage()
+	bool fDisambig=false;
+	bool fList=IsListTitle(url);
+	bool fBudgetSpent=false;
+
+	//Braces are matched within each top-level template only,
+	//so a mismatched brace elsewhere on the page does not affect the other templates
+	int curOpen=text.Find("{{",0);
+	while(curOpen!=-1)
+	{
+		int curClose=MatchBraces(text,curOpen,'{','}');
+		if(curClose==-1)
+		{
+			//Not closed - the templates in it are looked at as if it were not there
+			AddError("Infobox extraction: template skipped because of mismatched braces.");
+			curOpen=text.Find("{{",curOpen+2);
+			continue;
+		}
+
+		BString name=TemplateNameAt(text,curOpen);
+		if(disambigTargets.IsPresent(name)) fDisambig=true;
+		if(IsListTemplate(name)) fList=true;
+
+		if(name.Left(7)=="infobox" && !fBudgetSpent)
+		{
+			if(IsOverBudget())
+			{
+				AddError("Infoboxes discarded, page over time budget.");
+				fBudgetSpent=true;
+			}
+			else if(AppendInfoboxRecord(text.Mid(curOpen,curClose-curOpen+1),pageNode))
+				AddError("Infobox extracted successfully.");
+		}
+
+		curOpen=text.Find("{{",curClose+1);
+	}
+
+	if(fDisambig) pageNode.append_attribute("type").set_value("disambig");
+	else pageNode.append_attribute("type").set_value("article");
+
+	if(fList) pageNode.append_attribute("list").set_value("yes");
+
+	return true;
+}
+
+int CWikipediaParser::MatchBraces(const BString& text, int pos, char left, char right)
+{
+	int depth=0;
+	int length=text.GetLength();
+	for(int i=pos;i<length;i++)
+	{
+		if(text[i]==left) depth++;
+		else if(text[i]==right)
+		{
+			depth--;
+			if(depth==0) return i;
+		}
+	}
+
+	return -1;
+}
+
+BString CWikipediaParser::TemplateNameAt(const BString& text, int pos)
+{
+	int length=text.GetLength();
+	int end=pos+2;
+	while(end<length && text[end]!='|' && text[end]!='{' && text[end]!='}' && text[end]!='\n') end++;
+
+	BString name=text.Mid(pos+2,end-pos-2);
+	name.Replace("_"," ");
+	name.Trim();
+	name.MakeLower();
+	return name;
+}
+
+//Parses a single infobox invocation "{{Infobox ...}}" and appends its compact record to pageNode
+bool CWikipediaParser::AppendInfoboxRecord(const BString& infoboxText, xml_node& pageNode)
+{
+	//The infobox is small, so it is cleaned and parsed as a section of its own
+	xml_document parsed;
+	if(!ParseSection("<infobox>"+infoboxText+"</infobox>",parsed,false))
+	{
+		AddError("Infobox discarded because of critical section error.");
+		return false;
+	}
+
+	xml_node templateNode=GetNodeByName(parsed,"template");
+	if(!templateNode) return false;
+
+	ParametrizeTemplate(templateNode);
+
+	//Infobox type is the template target without the "infobox" prefix
+	BString type=templateNode.child("target").first_child().value();
+	type=type.Right(type.GetLength()-7);
+	type.Trim();
+	type.MakeLower();
+
+	xml_node recordNode=pageNode.append_child("infobox");
+	recordNode.append_attribute("type").set_value(type);
+
+	for(xml_node curParam=templateNode.child("param"); curParam; curParam=curParam.next_sibling("param"))
+	{
+		xml_attribute attrib=curParam.attribute("pn");
+		if(!attrib) continue;		//Only named params are kept
+
+		BString paramName=attrib.value();
+		BString value;
+
+		bool fImage=infoImageMarkers.IsPresent(paramName);
+		xml_node fileNode=curParam.child("file");
+		if(fImage && fileNode) value=fileNode.child("target").first_child().value();
+		else
+		{
+			ProcessSpecialTemplates(curParam);
+			WriteContentToString(curParam,value);
+		}
+		value.Trim();
+		if(value=="") continue;
+
+		xml_node paramNode=recordNode.append_child("param");
+		paramNode.append_attribute("n").set_value(paramName);
+		if(fImage) paramNode.append_attribute("role").set_value("image");
+		else if(infoCaptionMarkers.IsPresent(paramName)) paramNode.append_attribute("role").set_value("caption");
+		paramNode.append_child(node_pcdata).set_value(value);
+	}
+
+	return true;
 }
 
 //Converts a <gallery> tag to gallery template
@@ -1262,8 +1734,9 @@ void CWikipediaParser::GalleryTagToTemplate(xml_node& galleryNode)
 	content.Replace("|","</param><param>");
 
 	content="<text><param>"+content+"</param></text>";
+	BString docBuffer;
 	xml_document galleryDoc;
-	if(!StringToXml(galleryDoc,content))
+	if(!StringToXmlInPlace(galleryDoc,content,docBuffer))
 	{
 		AddError("Error parsing parameter XML in a <gallery> tag.");
 		return;
@@ -1306,26 +1779,6 @@ void CWikipediaParser::RemoveLeadingLists(xml_document& doc)
 	}
 }
 
-//Places all images in each section after the last text paragraph or list
-//Does nothing with the text in subsections
-void CWikipediaParser::MoveImagesToEndOfSections(xml_document& doc)
-{
-	xml_node textNode=doc.child("page").child("text");
-	if(!textNode) return;
-
-	//Call MoveImagesToEnd() on each section content, including firstPara
-    xml_node firstPara = textNode.child("firstPara");
-    MoveImagesToEnd(firstPara);
-
-	CHArray<xml_node> sections(50);
-	GetNodesByName(textNode,"section",sections);
-    for(int i=0;i<sections.Count();i++)
-    {
-        xml_node temp = sections[i].child("secContent");
-        MoveImagesToEnd(temp);
-    }
-}
-
 //moves template param names into the xml parameter, <param n="caption">blah</param>
 void CWikipediaParser::ParametrizeTemplate(xml_node& templateNode)
 {
@@ -1388,12 +1841,10 @@ void CWikipediaParser::MoveImagesToEnd(xml_node& contentNode)
 	RemoveEmptyParChildren(contentNode,false);
 }
 
-//Whether the page is a list page - list, set index, date, year, etc.
-bool CWikipediaParser::IsListPage(xml_document& doc)
+//Whether the title is that of a list page - list, date, year, etc.
+//Set index and other list templates are checked by ListTemplateVisit()
+bool CWikipediaParser::IsListTitle(const BString& title)
 {
-	//Test the title with regexes
-	BString title=doc.child("page").child("title").first_child().value();
-
 	//Regex to check the title for list pages
 	RE2 re(
 	"(^(List of|Lists of|Outline of|Glossary of|Timeline of|Timeline for|Index of) .*)|"
@@ -1408,23 +1859,7 @@ bool CWikipediaParser::IsListPage(xml_document& doc)
 	"(^\\d{3,4}$)|"	//Check for 1945, etc.
 	"(.* at the \\d{4} (Summer|Winter) Olympics$)"	//Check for things like "Boxing at the 1998 Summer Olympics", etc.
 	);
-	if(RE2::FullMatch((const char*)title,re)) return true;
-
-	//Check the templates
-	CHArray<xml_node> templates(200);
-	GetNodesByName(doc,"template",templates);
-
-	for(int i=0;i<templates.Count();i++)
-	{
-		BString name=templates[i].child("target").first_child().value();
-		name.MakeLower();
-		if(name=="set index" || name=="sia" || name=="set index article") return true;
-		if(name=="months" || name=="yearbox" || name=="events by month links") return true;
-
-		if(name.Left(9)=="years in ") return true;
-	}
-
-	return false;
+	return RE2::FullMatch((const char*)title,re);
 }
 
 //Extracts namespace from the string with the page data
@@ -1445,49 +1880,6 @@ int CWikipediaParser::GetNamespace(const BString& text)
 	return atoi(ns);
 }
 
-//Removes nodes for, interwiki links and categories
-//Removes templates, except those listed in retainedTemplates
-void CWikipediaParser::ConditionalRemoveNodes1(xml_node& node)
-{
-	xml_node child=node.first_child();
-	while(child)
-	{
-		xml_node curChild=child;
-		child=child.next_sibling();
-
-		if(curChild.type()==node_element)
-		{
-			BString name=curChild.name();
-
-			bool fRemove=false;
-
-			//remove nodes based on name
-			if(name=="interwiki" || name=="category" || name=="wTable" || name=="div")	fRemove=true;
-
-			//Remove all templates, except those specified in retainedTemplates
-			//and infobox templates
-			if(name=="template")
-			{
-				BString target=curChild.child("target").first_child().value();
-				target.MakeLower();
-				if( ! retainedTemplates.IsPresent(target) && target.Left(7)!="infobox") fRemove=true;
-			}
-
-			//remove nodes based on section name
-			if(name=="section")
-			{
-				BString secTitle=curChild.child("secTitle").first_child().value();
-
-				if(secTitle=="References" || secTitle=="External links" || secTitle=="Bibliography" || secTitle=="Footnotes" ||
-					secTitle=="Further reading" || secTitle=="Notes") fRemove=true;
-			}
-
-			if(fRemove) node.remove_child(curChild);	//Remove the child if necessary
-			else ConditionalRemoveNodes1(curChild);		//or place a recursive call if not
-		}
-	}
-}
-
 //Replaces all CR-LF with LF
 //And limits all LF runs to a max of 2
 void CWikipediaParser::HandleCRLF(BString& text)
@@ -1528,18 +1920,19 @@ void CWikipediaParser::HandleCRLF(BString& text)
 void CWikipediaParser::ParseLinks(xml_node& node)
 {
 	//if it is an external link
-	if(BString(node.name())=="extLink")
+	if(XmlTags::GetTag(node)==tagExtLink)
 	{
 		//First, add element for the target
 		xml_node curNodeToExpand=node.append_child("target");
 		bool fSpaceFound=false;
 	
 		xml_node child=node.first_child();
-		while(child && BString(child.name())!="target")
+		while(child && XmlTags::GetTag(child)!=tagTarget)
 		{
+			xml_node nextChild=child.next_sibling();		//child may be moved into the new elements
 			if(child.type()!=node_pcdata && !fSpaceFound) //it is not text
 			{
-				curNodeToExpand.append_copy(child);
+				curNodeToExpand.append_move(child);
 			}
 			else		//it is text
 			{
@@ -1548,7 +1941,7 @@ void CWikipediaParser::ParseLinks(xml_node& node)
 				int pos1=value.Find(' ');
 				if(pos1==-1) //No space is found
 				{
-					curNodeToExpand.append_copy(child);
+					curNodeToExpand.append_move(child);
 				}
 				else	//space found - everything else is going to be anchor text
 				{
@@ -1560,7 +1953,7 @@ void CWikipediaParser::ParseLinks(xml_node& node)
 					newNode.set_value(value.Mid(pos1+1,value.GetLength()-pos1));
 				}
 			}
-			child=child.next_sibling();
+			child=nextChild;
 
 		}//end iterate over children of extLink
 
@@ -1580,18 +1973,19 @@ void CWikipediaParser::ParseLinks(xml_node& node)
 	}//end if extLink
 
 	//if it is an internal link
-	if(BString(node.name())=="link")
+	if(XmlTags::GetTag(node)==tagLink)
 	{
 		xml_node curNodeToExpand=node.append_child("target");
 		int numPipesSeen=0;
 	
 		//iterate over children
 		xml_node child=node.first_child();
-		while(child && BString(child.name())!="target")
+		while(child && XmlTags::GetTag(child)!=tagTarget)
 		{
+			xml_node nextChild=child.next_sibling();		//child may be moved into the new elements
 			if(child.type()!=node_pcdata) //it is not text
 			{
-				curNodeToExpand.append_copy(child);
+				curNodeToExpand.append_move(child);
 			}
 			else		//it is text
 			{
@@ -1619,7 +2013,7 @@ void CWikipediaParser::ParseLinks(xml_node& node)
 					curTextNode.set_value(curText);
 				}
 			}
-			child=child.next_sibling();
+			child=nextChild;
 
 		}//end iterate over children of link
 
@@ -1658,7 +2052,7 @@ void CWikipediaParser::ParseLinks(xml_node& node)
 				//Captions to pre-existing file links are added here
 				//Captions for <file> created from templates and galleries are added by SetFileCaption()
 				xml_node last=node.last_child();
-				if(last && BString(last.name())=="param" && IsProperCaption(last)) last.set_name("caption");
+				if(last && XmlTags::GetTag(last)==tagParam && IsProperCaption(last)) last.set_name("caption");
 				else node.append_child("caption");
 			}
 			if(!fTypeFound && string.Left(6)=="Media:")
@@ -1679,7 +2073,7 @@ void CWikipediaParser::ParseLinks(xml_node& node)
 		}
 
 		//if it is still an internal link, change the name of the first parameter to "anchor" (and add it if it does not exist)
-		if(BString(node.name())=="link")
+		if(XmlTags::GetTag(node)==tagLink)
 		{
 			xml_node targetNode=node.child("target");
 			xml_node firstParam=targetNode.next_sibling();
@@ -1897,66 +2291,73 @@ void CWikipediaParser::ProcessSpecialTemplates(xml_node& node)
 		if(curNode.type()!=node_element) continue;
 
 		bool fTemplFound=false;
-		if(BString(curNode.name())=="template")		//if the current element is a template
-		{
-			BString target=curNode.child("target").first_child().value();
-			target.MakeLower();
+		if(BString(curNode.name())=="template") fTemplFound=ProcessSpecialTemplate(curNode);
 
-			//if it is a convert template
-			if(!fTemplFound && target.Left(4)=="conv" && 
-					(target=="convert" || target=="convert/2" || target=="convert/3" || target=="convert/4"))
-			{fTemplFound=true;TemplateConvert(curNode);	}
+		if(!fTemplFound) ProcessSpecialTemplates(curNode);
+	}
 
-			if(!fTemplFound && target.Left(5)=="lang-")
-			{fTemplFound=true;TemplateLang(curNode);}
+	return;
+}
 
-			if(!fTemplFound && target=="nihongo")
-			{fTemplFound=true;TemplateNihongo(curNode);	}
+//Processes a single template if it is one of the special ones, returns whether it was
+bool CWikipediaParser::ProcessSpecialTemplate(xml_node& templateNode)
+{
+	BString target=templateNode.child("target").first_child().value();
+	target.MakeLower();
 
-			if(!fTemplFound && target=="double image")
-			{fTemplFound=true;TemplateDoubleImage(curNode);}
+	bool fTemplFound=false;
 
-			if(!fTemplFound && target=="triple image")
-			{fTemplFound=true;TemplateTripleImage(curNode);}
+	//if it is a convert template
+	if(!fTemplFound && target.Left(4)=="conv" && 
+			(target=="convert" || target=="convert/2" || target=="convert/3" || target=="convert/4"))
+	{fTemplFound=true;TemplateConvert(templateNode);	}
 
-			if(!fTemplFound && target=="multiple image")
-			{fTemplFound=true;TemplateMultipleImage(curNode);}
+	if(!fTemplFound && target.Left(5)=="lang-")
+	{fTemplFound=true;TemplateLang(templateNode);}
 
-			if(!fTemplFound && target=="gallery")
-			{fTemplFound=true;TemplateGallery(curNode);	}
+	if(!fTemplFound && target=="nihongo")
+	{fTemplFound=true;TemplateNihongo(templateNode);	}
 
-			if(!fTemplFound && target.Left(7).MakeLower()=="infobox")
-			{fTemplFound=true;TemplateInfobox(curNode);}
+	if(!fTemplFound && target=="double image")
+	{fTemplFound=true;TemplateDoubleImage(templateNode);}
 
-			if(!fTemplFound && target=="quote")
-			{fTemplFound=true;TemplateQuote(curNode);}
+	if(!fTemplFound && target=="triple image")
+	{fTemplFound=true;TemplateTripleImage(templateNode);}
 
-			if(!fTemplFound && target=="quotation")
-			{fTemplFound=true;TemplateQuotation(curNode);}
+	if(!fTemplFound && target=="multiple image")
+	{fTemplFound=true;TemplateMultipleImage(templateNode);}
 
-			if(!fTemplFound && target=="bq")
-			{fTemplFound=true;TemplateBq(curNode);}
+	if(!fTemplFound && target=="gallery")
+	{fTemplFound=true;TemplateGallery(templateNode);	}
 
-			if(!fTemplFound && target=="centered pull quote")
-			{fTemplFound=true;TemplateCenteredPullQuote(curNode);}
+	if(!fTemplFound && target.Left(7).MakeLower()=="infobox")
+	{fTemplFound=true;TemplateInfobox(templateNode);}
 
-			if(!fTemplFound && target=="quote box")
-			{fTemplFound=true;TemplateQuoteBox(curNode);}
+	if(!fTemplFound && target=="quote")
+	{fTemplFound=true;TemplateQuote(templateNode);}
 
-			if(!fTemplFound && target=="quote box")
-			{fTemplFound=true;TemplateQuoteBox(curNode);}
+	if(!fTemplFound && target=="quotation")
+	{fTemplFound=true;TemplateQuotation(templateNode);}
 
-			if(!fTemplFound && target=="rquote")
-			{fTemplFound=true;TemplateRQuote(curNode);}
+	if(!fTemplFound && target=="bq")
+	{fTemplFound=true;TemplateBq(templateNode);}
 
-			if(!fTemplFound && target=="nowrap")
-			{fTemplFound=true;TemplateNowrap(curNode);}
-		}
+	if(!fTemplFound && target=="centered pull quote")
+	{fTemplFound=true;TemplateCenteredPullQuote(templateNode);}
 
-		if(!fTemplFound) ProcessSpecialTemplates(curNode);
-	}
+	if(!fTemplFound && target=="quote box")
+	{fTemplFound=true;TemplateQuoteBox(templateNode);}
 
-	return;
+	if(!fTemplFound && target=="quote box")
+	{fTemplFound=true;TemplateQuoteBox(templateNode);}
+
+	if(!fTemplFound && target=="rquote")
+	{fTemplFound=true;TemplateRQuote(templateNode);}
+
+	if(!fTemplFound && target=="nowrap")
+	{fTemplFound=true;TemplateNowrap(templateNode);}
+
+	return fTemplFound;
 }
 
 //Writes a quote from a quote template
@@ -2081,7 +2482,7 @@ void CWikipediaParser::CreateFileFromParams(xml_node& imageParam, xml_node& capt
 	xml_node fileNode=imageParam.child("file");
 	if(fileNode)
 	{
-		fileNode=insertBeforeNode.parent().insert_copy_before(fileNode,insertBeforeNode);
+		fileNode=insertBeforeNode.parent().insert_move_before(fileNode,insertBeforeNode);
 		//Delete the imageParam, so that the file isn't found twice by the image search function
 		imageParam.parent().remove_child(imageParam);
 	}
@@ -2237,7 +2638,7 @@ void CWikipediaParser::TemplateMultipleImage(xml_node& templateNode)
 }
 
 //Extracts images from Template:Gallery
-//Also used to extract images from Template:Gallery created by ProcessGalleryTags()
+//Also used to extract images from Template:Gallery created by GalleryTagVisit()
 //from <gallery> tags
 void CWikipediaParser::TemplateGallery(xml_node& templateNode)
 {
@@ -2329,71 +2730,121 @@ void CWikipediaParser::TemplateLang(xml_node& templateNode)
 //Non-recursive specialized function called by ProcessSpecialTemplates()
 void CWikipediaParser::TemplateConvert(xml_node& templateNode)
 {
+	if(convertUnits.Count()!=convertMap.Count()) ParseConvertUnits();
+
 	//iterate over all params of the template until one matches units
 	BString newString="";
 
 	xml_node param=templateNode.first_child().next_sibling();
-	bool fUnitsFound=false;
+	int unitIndex=-1;
 	while(param)
 	{
 		BString paramText=param.first_child().value();
 		paramText.Trim();
-		if(convertMap.IsPresent(paramText))		//units are found
-		{
-			int index=convertMap.GetIndex(paramText);
-			newString+=convertTable(1,index);
-			fUnitsFound=true;
-			break;
-		}
-		else	//these are not units
-		{
-			newString+=paramText;
-			newString+=" ";
-		}
+		unitIndex=convertMap.GetIndex(paramText);
+		if(unitIndex!=-1) break;		//units are found
+
+		//these are not units
+		newString+=paramText;
+		newString+=" ";
 		param=param.next_sibling();
 	}
 
-	if(fUnitsFound)	//convert template seems to have been parsed fully - replace the template with the newString
+	if(unitIndex==-1)	//convert template could not be parsed
 	{
-		newString="<a>"+newString;
-		newString+="</a>";
+		AddError("Non-critical error: convert template could not be parsed.");
+		return;
+	}
 
-		xml_document insDoc;
-		if(!StringToXml(insDoc,newString))
-		{
-			AddError("Non-critical error: XML parsing error while replacing a convert template.");
-			return;
-		}
+	xml_node units=convertUnits[unitIndex];
+	if(!units)
+	{
+		AddError("Non-critical error: XML parsing error while replacing a convert template.");
+		return;
+	}
 
-		xml_node insChild=insDoc.first_child().first_child();
-		while(insChild)
-		{
-			templateNode.parent().insert_copy_before(insChild,templateNode);
-			insChild=insChild.next_sibling();
-		}
+	//convert template seems to have been parsed fully - replace the template with the text and the units
+	if(templateCacheSize<=0)
+	{
+		xml_node fragment=templateNode.append_child("a");
+		RenderConvert(fragment,newString,units);
+		MoveChildrenBefore(fragment,templateNode);
+		templateNode.remove_child(fragment);
+		return;
+	}
+
+	//The same invocations repeat across the pages - they are rendered once and copied from the cache
+	BString key=newString+convertTable(1,unitIndex);
+	int index=templateCacheKeys.GetIndex(key);
+	if(index!=-1) templateCacheHits++;
+	else
+	{
+		templateCacheMisses++;
+		if(templateCacheKeys.Count()>=templateCacheSize) ClearTemplateCache();
+
+		xml_node fragment=templateCacheDoc.append_child("a");
+		RenderConvert(fragment,newString,units);
+
+		index=templateCacheKeys.AddWordGetIndex(key);
+		templateCacheNodes.AddAndExtend(fragment);
 	}
-	else	//convert template could not be parsed
+
+	CopyChildrenBefore(templateCacheNodes[index],templateNode);
+}
+
+//Parses the units of the convert template once, they are copied into the rendered templates
+void CWikipediaParser::ParseConvertUnits()
+{
+	convertUnitsDoc.reset();
+	convertUnits.SetNumPoints(0);
+
+	for(int i=0;i<convertMap.Count();i++)
 	{
-		AddError("Non-critical error: convert template could not be parsed.");
+		xml_node units=AppendParsed(convertUnitsDoc,"<u>"+convertTable(1,i)+"</u>");
+		convertUnits.AddAndExtend(units);
 	}
 }
 
+//Renders a convert template into fragment - the same nodes as parsing "<a>"+text+units+"</a>"
+//The text is merged with the leading text of the units
+void CWikipediaParser::RenderConvert(xml_node& fragment, const BString& text, xml_node& units)
+{
+	BString leadingText=text;
+	xml_node child=units.first_child();
+	if(child && child.type()==node_pcdata)
+	{
+		leadingText+=child.value();
+		child=child.next_sibling();
+	}
+
+	if(leadingText!="") fragment.append_child(node_pcdata).set_value(leadingText);
+	for(;child;child=child.next_sibling()) fragment.append_copy(child);
+}
+
+void CWikipediaParser::ClearTemplateCache()
+{
+	templateCacheDoc.reset();
+	templateCacheKeys.Clear();
+	templateCacheNodes.SetNumPoints(0);
+}
+
 void CWikipediaParser::ParseTemplates(xml_node& node)
 {
 	//Recursive function called on all nodes to process <template> elements
 	//to extract <templateName> and <parameter>s
 
-	if(BString(node.name())=="template")
+	if(XmlTags::GetTag(node)==tagTemplate)
 	{
 		//First, add elements for template target and params
 		xml_node curNodeToExpand=node.append_child("target");
 	
 		xml_node child=node.first_child();
-		while(child && BString(child.name())!="target")
+		while(child && XmlTags::GetTag(child)!=tagTarget)
 		{
+			xml_node nextChild=child.next_sibling();		//child may be moved into the new elements
 			if(child.type()!=node_pcdata) //it is not text
 			{
-				curNodeToExpand.append_copy(child);
+				curNodeToExpand.append_move(child);
 			}
 			else		//it is text
 			{
@@ -2421,7 +2872,7 @@ void CWikipediaParser::ParseTemplates(xml_node& node)
 					curTextNode.set_value(curText);
 				}
 			}
-			child=child.next_sibling();
+			child=nextChild;
 
 		}//end iterate over children of template
 
@@ -2445,7 +2896,7 @@ void CWikipediaParser::RemoveUpToTarget(xml_node& node)
 
 	xml_node nextSibling;
 	xml_node child=node.first_child();
-	while(child && BString(child.name())!="target")
+	while(child && XmlTags::GetTag(child)!=tagTarget)
 	{
 		nextSibling=child.next_sibling();
 		node.remove_child(child);
@@ -31,6 +31,9 @@
 #include "WikipediaParser.h"
 #include "Savable.h"
 #include "Matrix.h"
+#include "TreeVisitor.h"
+#include "XmlTags.h"
+#include "boost/thread.hpp"
 
 class CWikipediaParser : public Savable
 {
@@ -49,6 +52,7 @@ public:
 	CBidirectionalMap<BString> imExtensionMap;	//Map of image extensions
 
 	CBidirectionalMap<BString> retainedTemplates;	//Names of templates that are not removed after page parse - Infobox, Main, etc.
+	CBidirectionalMap<BString> discardedSections;	//Titles of sections that are skipped before parsing - References, External links, etc.
 	CHArray<BString> tagNamesForCleanup;		//Names of tags to remove in cleanup - ref, math, code
 	CHArray<BString> disambigTargets;			//Targets for various disambiguation templates
 	CHArray<BString> skipInNodeCleanup;		//Element names that are skipped when nodes are cleaned up with Tidy individually
@@ -63,7 +67,13 @@ public:
 	CBidirectionalMap<BString> errorMapTemplates;
 	CBidirectionalMap<BString> errorMapArtDisambigs;
 
-    void AddError(const BString& error, int numTimes=1){BString temp(error);curErrorMap->AddWord(temp,numTimes);};
+    void AddError(const BString& error, int numTimes=1)
+	{
+		boost::unique_lock<boost::recursive_mutex> lock(mutex,boost::defer_lock);
+		if(fPiecesParallel) lock.lock();
+		BString temp(error);
+		curErrorMap->AddWord(temp,numTimes);
+	};
 	void ClearErrorMaps(){errorMapGeneral.Clear();errorMapRedirects.Clear();errorMapTemplates.Clear();errorMapArtDisambigs.Clear();};
 	void AppendErrorMaps(CWikipediaParser& otherParser)
 	{
@@ -74,7 +84,89 @@ public:
 	};
 	void WriteReport(std::ostream& report);
 
+	//Statistics for sections skipped by title, accumulated over all parsed pages
+	int numSkippedSections;
+	int64 skippedSectionBytes;
+
+	//Pages that ran over the time budget, accumulated over all parsed pages
+	CHArray<BString> overBudgetTitles;
+
+	//Time spent in each post-processing pass, accumulated over all parsed pages if pass timing is on
+	CHArray<BString> passTimeNames;
+	CHArray<double> passTimeSeconds;
+
+	//Convert templates rendered from the template cache and rendered anew
+	int64 templateCacheHits;
+	int64 templateCacheMisses;
+
+	void ClearStats()
+	{
+		numSkippedSections=0;skippedSectionBytes=0;overBudgetTitles.SetNumPoints(0);
+		passTimeNames.SetNumPoints(0);passTimeSeconds.SetNumPoints(0);
+		templateCacheHits=0;templateCacheMisses=0;
+	};
+	void AppendStats(CWikipediaParser& otherParser)
+	{
+		numSkippedSections+=otherParser.numSkippedSections;
+		skippedSectionBytes+=otherParser.skippedSectionBytes;
+		templateCacheHits+=otherParser.templateCacheHits;
+		templateCacheMisses+=otherParser.templateCacheMisses;
+		for(int i=0;i<otherParser.overBudgetTitles.Count();i++) overBudgetTitles.AddAndExtend(otherParser.overBudgetTitles[i]);
+		for(int i=0;i<otherParser.passTimeNames.Count();i++) AddPassTime(otherParser.passTimeNames[i],otherParser.passTimeSeconds[i]);
+	};
+
+	//Replaces the list of section titles that are discarded without parsing
+	//The list is normally read from "Discarded sections.txt" in the parser data files
+	void SetDiscardedSections(const CHArray<BString>& titles) {discardedSections.CreateFromArray(titles);};
+
+	//Per-page time budget in seconds, 0 means no budget
+	//The budget is checked at stage boundaries - Tidy calls, sections and node-level cleanup
+	//A page over budget is degraded: remaining Tidy calls fail and remaining sections are dropped
+	//If fAbort is set, the page is aborted instead and ParseArticle returns false
+	void SetPageTimeBudget(double seconds, bool fAbort=false) {pageTimeBudget=seconds;fAbortOverBudget=fAbort;};
+
+	//Sections of pages with at least minPageSize bytes of text are parsed in up to numThreads jobs on the shared CThreadPool
+	//Smaller pages, or numThreads<2, are parsed sequentially
+	void SetParallelSections(int numThreads, int minPageSize) {sectionThreads=numThreads;parallelPageSize=minPageSize;};
+
+	//Whether the time of each post-processing pass is measured and added to passTimeNames/passTimeSeconds
+	void SetPassTiming(bool val) {fPassTiming=val;};
+
+	//Maximum number of rendered convert templates kept by the parser, 0 - no cache
+	void SetTemplateCacheSize(int numEntries) {templateCacheSize=numEntries;ClearTemplateCache();};
+
 private:
+	boost::recursive_mutex mutex;		//Guards error maps and budget state when sections are parsed in parallel
+	bool fPiecesParallel;				//Set while ParseSectionPieces() runs in parallel - the mutex is only taken then
+
+	int sectionThreads;
+	int parallelPageSize;
+	bool fPassTiming;
+
+	//Units of the convert template, convertTable(1,i) parsed once into convertUnitsDoc
+	//A null node if the units could not be parsed
+	xml_document convertUnitsDoc;
+	CHArray<xml_node> convertUnits;
+
+	//Rendered convert templates, keyed by the normalized invocation - the parameter text and units
+	//Each parser has its own cache, and each parsing thread its own parser
+	//The cache is bounded: when it is full, it is emptied and filled again
+	xml_document templateCacheDoc;
+	CBidirectionalMap<BString> templateCacheKeys;
+	CHArray<xml_node> templateCacheNodes;		//<a> elements in templateCacheDoc, with the same index as the key
+	int templateCacheSize;
+
+	double pageTimeBudget;
+	bool fAbortOverBudget;
+	bool fOverBudget;			//Set when the current page runs over the budget
+	BString curPageTitle;		//Title of the current page, for logging
+
+	//Starts the time budget for a new page - timer 0 is used
+	void StartPageBudget(const BString& title) {timer.SetTimerZero(0);fOverBudget=false;curPageTitle=title;};
+
+	//Checks the budget for the current page, logs the page the first time it goes over
+	bool IsOverBudget();
+
 	void WriteErrorMap(std::ostream& report, CBidirectionalMap<BString>& theErrorMap);
 
 //Reading serialized and plain parser data
@@ -90,6 +182,15 @@ public:
 	//If there is an error in the section, that section is discarded
 	bool ParseArticle(BString& page, xml_document& output);
 
+	//Infobox-only extraction mode, a much cheaper alternative to ParseArticle
+	//Receives the same <page>...</page> string, but only parses the top-level {{Infobox ...}} invocations
+	//Tidy, link and paragraph processing is skipped for the rest of the page
+	//Output is a compact record: <page type="article"><url/><title/><infobox type="settlement"><param n="name">...</param>...</infobox></page>
+	//Image and caption params (infoImageMarkers, infoCaptionMarkers) are marked with role="image" and role="caption"
+	//Redirects are handled as in ParseArticle, templates and all other pages get type="other"
+	//Articles get type="article" or type="disambig" and the list attribute from their templates, as in ParseArticle
+	bool ExtractInfoboxes(BString& page, xml_document& output);
+
 	//Replace everything in the <par> and <listEl> nodes with their printed contents
 	//And remove unprintable nodes and empty <par>
 	//Used in creating simplified XML structure for DizzySearcher
@@ -106,13 +207,30 @@ public:
 	void ParametrizeTemplate(xml_node& templateNode);
 
 private:
+	//Parses a redirect page text and sets the type and target attributes on the <page> node in doc
+	//Called by ParseArticle and ExtractInfoboxes
+	bool ParseRedirect(BString& text, xml_document& doc);
+
+	//Parses a single infobox invocation "{{Infobox ...}}" and appends its compact record to pageNode
+	//Called by ExtractInfoboxes
+	bool AppendInfoboxRecord(const BString& infoboxText, xml_node& pageNode);
+
 	//processes each section from an article
 	//if it encounters an error, it quits and returns false
 	//Called by ParseArticle on each section (separately on section title and section text)
 	//fAlreadyCleaned specifies whether the page (and section) has already been cleaned with tidy
 	//and references were removed
 	//If not, cleaning will be performed
-	bool ParseSection(const BString& theSection, xml_document& output, bool fAlreadyCleaned);
+	//The root node of the section is appended to parent, which can be a document
+	bool ParseSection(const BString& theSection, xml_node& parent, bool fAlreadyCleaned);
+
+	//Calls ParseSection on each non-empty piece, in parallel or sequentially
+	//Each piece is appended to targets[i], parsed[i] is set to its root node
+	//Called by ParseArticle
+	void ParseSectionPieces(CHArray<BString>& pieces, CHArray<xml_node>& targets, CHArray<xml_node>& parsed,
+								CHArray<char>& results, bool fCleaned, bool fParallel);
+	void ParseSectionPiecesThread(CHArray<BString>& pieces, CHArray<xml_node>& targets, CHArray<xml_node>& parsed,
+								CHArray<char>& results, bool fCleaned, int& nextPiece);
 
 	//Parses braces in the provided string (text), such as left='{' and right='}'
 	//Called by ParseSection
@@ -134,11 +252,19 @@ private:
 	//Calls specialized non-recursive functions that begin with Template
 	void ProcessSpecialTemplates(xml_node& node);
 
+	//Processes a single template if it is one of the special ones, returns whether it was
+	bool ProcessSpecialTemplate(xml_node& templateNode);
+
 	//Inserts <listEl> tags into paragraphs - called by ParseSection()
 	bool InsertListElInParagraph(xml_node& parNode);
 	
 	//Specialized non-recursive functions called by ProcessSpecialTemplates()
 	void TemplateConvert(xml_node& templateNode);
+
+	//Helpers of TemplateConvert()
+	void ParseConvertUnits();
+	void RenderConvert(xml_node& fragment, const BString& text, xml_node& units);
+	void ClearTemplateCache();
 	void TemplateNowrap(xml_node& templateNode);
 	void TemplateLang(xml_node& templateNode);
 	void TemplateNihongo(xml_node& templateNode);
@@ -179,17 +305,39 @@ private:
 	//Handles '', ''', ''''' markers
 	void ProcessBoldItalic(BString& text);
 
-	//Removes nodes for templates, interwiki links and categories
-	void ConditionalRemoveNodes1(xml_node& node);
+	//Sets the page type and runs the postprocessing on a parsed page
+	//Each group of passes is fused into a single traversal of the tree
+	void PostProcessPage(xml_document& doc);
+
+	//Passes of the page classification traversal, fFound is set when the template is found
+	//Disambiguation templates are not looked for inside other templates
+	CTreeVisitor::VisitResult DisambigTemplateVisit(xml_node& node, bool& fFound);
+	CTreeVisitor::VisitResult ListTemplateVisit(xml_node& node, bool& fFound);
+
+	//Passes of the postprocessing traversal
+	CTreeVisitor::VisitResult GalleryTagVisit(xml_node& node);			//<gallery> tags to gallery templates
+	CTreeVisitor::VisitResult SpecialTemplateVisit(xml_node& node);		//Special templates, as in ProcessSpecialTemplates()
+	CTreeVisitor::VisitResult ConditionalRemoveVisit(xml_node& node);	//Removes templates, interwiki links and categories
+	void MoveImagesLeave(xml_node& node);								//Images to the end of <firstPara> and sections
+
+	//Whether the title is that of a list page - 
+	//List of, Index of, Outline of, date, year, etc.
+	bool IsListTitle(const BString& title);
 
-	//Looks for one of the disambiguation templates
-	//In the tree structure and returns true if found
-	//otherwise false
-	bool IsDisambiguationPage(xml_node& node);
+	//Whether the template with this lowercase name marks a list page - set index, years in, etc.
+	bool IsListTemplate(const BString& name);
 
-	//Determines whether the parsed page is a list page - 
-	//List of, Index of, Outline of, Set index, date, year, etc.
-	bool IsListPage(xml_document& doc);
+	//Position of the brace that closes the set opened at pos, counting braces from pos only
+	//-1 if the set is not closed before the end of the text
+	//Called by ExtractInfoboxes, so that a stray brace only affects the template it is in
+	int MatchBraces(const BString& text, int pos, char left, char right);
+
+	//Lowercase name of the template that starts with "{{" at pos, up to the first '|', brace or line break
+	BString TemplateNameAt(const BString& text, int pos);
+
+	//Adds the pass times of the visitor to the statistics
+	void AddPassTimes(CTreeVisitor& visitor);
+	void AddPassTime(const BString& name, double seconds);
 
 	//Check whether the last param of a file node really is a caption
 	bool IsProperCaption(xml_node& paramNode);
@@ -208,7 +356,7 @@ private:
 	//For a section, ensure that lists are in section-level <list> elements
 	//Renames paragraphs with listEls into <list> elements
 	//Non-recursive, operates on top-level paragraphs only (all paragraphs are top-level in the section)
-	void MoveListElToLists(xml_document& section);
+	void MoveListElToLists(xml_node& secNode);
 
 	//Extracts namespace from the string with the page data
 	//0 - article, disambig, redirect, 10-template, -10 - error, anything else - "other"
@@ -239,10 +387,6 @@ private:
 	//Until a printable <par> is found
 	void RemoveLeadingLists(xml_document& doc);
 
-	//Places all images in each section after the last text paragraph or list
-	//Does nothing with the text in subsections
-	void MoveImagesToEndOfSections(xml_document& doc);
-
 	//Called on the "content" node of a section
 	//Moves each image to the end of the content section
 	//into its own paragraph
@@ -264,9 +408,6 @@ private:
 	//Whether the <param> node contains string with File: or Image: in it
     bool ParamContainsFileString(const pugi::xml_node &paramNode);
 
-	//Extracts images from all <gallery> tags
-	void ProcessGalleryTags(xml_node& node);
-
 	//Extracts images from a single gallery
 	void GalleryTagToTemplate(xml_node& galleryNode);
 
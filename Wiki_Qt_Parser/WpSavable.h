@@ -36,7 +36,10 @@ public:
 			& checkDiscardDisambigs & checkDiscardCaptions
 			& checkMarkArticles & checkMarkSections & checkMarkCaptions
 			& radioCoresMinus1 & radioAllCores & radioOtherCores
-			& numOtherCores;
+			& numOtherCores
+			& checkInfoboxOnly & pageTimeBudget & largePageKB
+			& checkFusedPlainText & checkPassTiming & checkCompressXml
+			& checkKeepPageIndex;
 	}
 
 public:
@@ -55,5 +58,14 @@ public:
 	bool radioAllCores;
 	bool radioOtherCores;
 	int numOtherCores;
+
+	//Advanced options - added at the end, so that settings saved without them still load
+	bool checkInfoboxOnly;
+	double pageTimeBudget;		//Seconds per page, 0 - no budget
+	int largePageKB;			//Pages of at least this size go to the large-page lane, 0 - no large-page lane
+	bool checkFusedPlainText;	//Plain text is written by the parser, otherwise by ThreadedWriter after the parse
+	bool checkPassTiming;		//Post-processing pass times are added to the report
+	bool checkCompressXml;		//The XML file is block-compressed
+	bool checkKeepPageIndex;	//The page index is saved in the memory-mapped format and kept in the output directory
 };
 
@@ -22,6 +22,7 @@
 
 #include "wiki_qt_parser.h"
 #include <QMessageBox>
+#include <QInputDialog>
 #include <QThread>
 #include <QDesktopServices>
 #include <QUrl>
@@ -56,6 +57,7 @@ Wiki_Qt_Parser::Wiki_Qt_Parser(QWidget *parent)
 	parser.SetXmlFileName(xmlFile);
 	parser.SetIiaFileName(iiaFile);
 	parser.SetPageIndexFileName(pageIndexFile);
+	parser.SetPlainTextFileName(plainTextFile);
 
 	//Prepended to XML to make it legal XML
 	//We'll need to append </pages> at the end after the parsing is done
@@ -74,6 +76,8 @@ Wiki_Qt_Parser::Wiki_Qt_Parser(QWidget *parent)
 	connect(ui.actionAbout,SIGNAL(triggered()),this,SLOT(AboutMenuItemClicked()));
 	connect(ui.actionHowToUse,SIGNAL(triggered()),this,SLOT(HowToUseMenuItemClicked()));
 	connect(ui.actionLicense,SIGNAL(triggered()),this,SLOT(LicenseMenuItemClicked()));
+	connect(ui.actionPageTimeBudget,SIGNAL(triggered()),this,SLOT(PageTimeBudgetClicked()));
+	connect(ui.actionLargePageSize,SIGNAL(triggered()),this,SLOT(LargePageSizeClicked()));
 
 	connect(ui.bnGoToFolder,SIGNAL(clicked()),this,SLOT(GoToFolderClicked()));
 
@@ -123,6 +127,10 @@ Wiki_Qt_Parser::Wiki_Qt_Parser(QWidget *parent)
 	//Parser options
 	parser.SetShortReport(true);
 
+	fFusedPlainText = false;
+	fCompressedXml = false;
+	fKeepPageIndex = false;
+
 	//Attempt to load all savable dialog data and show it in the dialog
 	Load();
 
@@ -166,6 +174,34 @@ void Wiki_Qt_Parser::SkipImageCaptionsClicked()
 	ui.checkMarkCaptions->setEnabled( !ui.checkSkipImageCaptions->isChecked() );
 }
 
+//User wants to change the time budget for a single page
+void Wiki_Qt_Parser::PageTimeBudgetClicked()
+{
+	bool ok;
+	double seconds = QInputDialog::getDouble(this, "Page time budget",
+							"Maximum time in seconds to spend on a single page, 0 for no limit.\n"
+							"Pages over the budget are saved without the sections that were not parsed in time.",
+							savable.pageTimeBudget, 0, 3600, 1, &ok);
+	if(!ok) return;
+
+	savable.pageTimeBudget = seconds;
+	Save();
+}
+
+//User wants to change the size from which pages are parsed largest-first
+void Wiki_Qt_Parser::LargePageSizeClicked()
+{
+	bool ok;
+	int size = QInputDialog::getInt(this, "Large page size",
+							"Pages of at least this many kilobytes are parsed first, largest first, 0 to parse all pages in order.\n"
+							"This keeps the few very large pages from being parsed last, on their own.",
+							savable.largePageKB, 0, 2000000, 100, &ok);
+	if(!ok) return;
+
+	savable.largePageKB = size;
+	Save();
+}
+
 void Wiki_Qt_Parser::AboutMenuItemClicked()
 {
 	auto about = new AboutDialog(this);
@@ -175,6 +211,15 @@ void Wiki_Qt_Parser::AboutMenuItemClicked()
 //Load all savable data from the dialog
 void Wiki_Qt_Parser::Load()
 {
+	//Advanced options keep these defaults if the saved settings do not have them
+	savable.checkInfoboxOnly		= false;
+	savable.pageTimeBudget			= 0;
+	savable.largePageKB				= 1000;
+	savable.checkFusedPlainText		= true;
+	savable.checkPassTiming			= false;
+	savable.checkCompressXml		= false;
+	savable.checkKeepPageIndex		= false;
+
 	bool res = savable.Load(savableFile);
 	if(!res)		//Load unsuccessful - probably no such file, yet
 	{
@@ -212,6 +257,12 @@ void Wiki_Qt_Parser::Load()
 	ui.radioOtherCores->setChecked(savable.radioOtherCores);
 	ui.editOtherCores->setText(QString::number(savable.numOtherCores));
 
+	ui.actionInfoboxOnly->setChecked(savable.checkInfoboxOnly);
+	ui.actionFusedPlainText->setChecked(savable.checkFusedPlainText);
+	ui.actionPassTiming->setChecked(savable.checkPassTiming);
+	ui.actionCompressXml->setChecked(savable.checkCompressXml);
+	ui.actionKeepPageIndex->setChecked(savable.checkKeepPageIndex);
+
 	SkipImageCaptionsClicked();
 }
 
@@ -232,6 +283,12 @@ void Wiki_Qt_Parser::Save()
 	savable.radioOtherCores			= ui.radioOtherCores->isChecked();
 	savable.numOtherCores			= ui.editOtherCores->text().toInt();
 
+	savable.checkInfoboxOnly		= ui.actionInfoboxOnly->isChecked();
+	savable.checkFusedPlainText		= ui.actionFusedPlainText->isChecked();
+	savable.checkPassTiming			= ui.actionPassTiming->isChecked();
+	savable.checkCompressXml		= ui.actionCompressXml->isChecked();
+	savable.checkKeepPageIndex		= ui.actionKeepPageIndex->isChecked();
+
 	savable.Save(savableFile);
 }
 
@@ -390,6 +447,16 @@ void Wiki_Qt_Parser::BnStartClicked()
 
 	fTestRun = ui.checkTestRun->isChecked();
 
+	//Plain text is either rendered by the parser workers from the pages they have just parsed,
+	//or written by ThreadedWriter from the XML file once the parse is done
+	fFusedPlainText = ui.actionFusedPlainText->isChecked();
+
+	//The compressed XML file can only be read through CAISFileFetcher, with the iia and the block index
+	fCompressedXml = ui.actionCompressXml->isChecked();
+
+	//The page index (titles, links, anchors) is only written when it is kept for the user
+	fKeepPageIndex = ui.actionKeepPageIndex->isChecked();
+
 	//Figure out the number of threads
 	int numThreads = -1;
 	if(ui.radioAllCoresMinOne->isChecked()) numThreads = numCoresMinOne;
@@ -429,7 +496,12 @@ void Wiki_Qt_Parser::BnStartClicked()
 	//Set parser options
 	parser.SetDiscardLists(ui.checkDiscardListPages->isChecked());
 	parser.SetDiscardDisambigs(ui.checkDiscardDisambigs->isChecked());
-	parser.SetWritePageIndex(false);
+	parser.SetWritePageIndex(fKeepPageIndex);
+	parser.SetInfoboxOnly(ui.actionInfoboxOnly->isChecked());
+	parser.SetPageTimeBudget(savable.pageTimeBudget);
+	parser.SetLargePageSize((int64)savable.largePageKB * 1000);
+	parser.SetPassTiming(ui.actionPassTiming->isChecked());
+	parser.SetXmlBlockCompression(fCompressedXml ? 1024*1024 : 0);
 
 	//Tell the parser the input file name for reporting purposes
 	parser.SetInputFileForReport(savable.inputFile);
@@ -439,6 +511,11 @@ void Wiki_Qt_Parser::BnStartClicked()
 	writer.SetMarkArticles(ui.checkMarkArticles->isChecked());
 	writer.SetMarkSections(ui.checkMarkSections->isChecked());
 	writer.SetMarkCaptions(ui.checkMarkCaptions->isChecked());
+	writer.SetNumThreads(numThreads);
+
+	//The writer's options are used by the parser workers in the fused mode
+	if(fFusedPlainText) parser.SetPlainTextRenderer(&writer);
+	else parser.SetPlainTextRenderer(NULL);
 
 	//Start parse asynchronously
 	parser.Parse(	&streambuf,
@@ -475,6 +552,14 @@ void Wiki_Qt_Parser::OnTimer()
 
 			//The parser was running, but has now stopped - change machine state
 			parserRunning = false;
+
+			//Plain text has already been written by the parser
+			if(fFusedPlainText)
+			{
+				OnTimerFinalize();
+				return;
+			}
+
 			writerRunning = true;
 
 			//Set the maximum on progBar
@@ -519,7 +604,7 @@ void Wiki_Qt_Parser::OnTimerFinalize()
 	ui.bnStart->setText("Start again");
 
 	//Get writer report
-	writer.Report(parserReport);
+	if(!fFusedPlainText) writer.Report(parserReport);
 
 	//Save report
 	std::ofstream reportStream(directory + reportFile, std::ios::binary);
@@ -533,11 +618,13 @@ void Wiki_Qt_Parser::OnTimerFinalize()
 	QFile::copy( (exeDir + "xml_schema.txt").c_str() , (directory + "xml_schema.txt").c_str() );
 
 	//Delete intermediate files
-	QFile::remove((directory + iiaFile).c_str());
-	QFile::remove((directory + pageIndexFile).c_str());
+	//The iia and the block index are kept with a compressed XML file, which cannot be read without them
+	if(!fCompressedXml) QFile::remove((directory + iiaFile).c_str());
+	if(!fKeepPageIndex) QFile::remove((directory + pageIndexFile).c_str());
 
 	//Finilize the XML file:
-	//Append the </pages> tag at the end
+	//Append the </pages> tag at the end - a compressed file is not valid XML anyway
+	if(!fCompressedXml)
 	{
 		std::ofstream  xmlStream(directory + xmlFile, std::ios::binary | std::ios::app);	//append
 		xmlStream << "</pages>";
@@ -614,10 +701,13 @@ void Wiki_Qt_Parser::ProcessPageIndex(PageIndex& index)
 {
 	index.artDisambigUrls.WriteStrings(directory + artTitleFile);
 
-	index.redirectFrom += "\t\t-->\t\t";
-	index.redirectFrom += index.redirectTo;
+	CHArray<BString> redirects(index.redirectFrom.Count());
+	for(int i=0;i<index.redirectFrom.Count();i++)
+	{
+		redirects.AddPoint(index.redirectFrom[i] + "\t\t-->\t\t" + index.redirectTo[i]);
+	}
 
-	index.redirectFrom.WriteStrings(directory + redirectFile);
+	redirects.WriteStrings(directory + redirectFile);
 }
 
 
@@ -91,6 +91,9 @@ private:
 	bool fTestRun;				//Flag to indicate that the current run is a test run
 	int numArtsInProgBar;		//The number of pages 
 	int pagesToWrite;			//Once the parse has completed, we know how many pages we have to write as plain text
+	bool fFusedPlainText;		//Plain text is written by the parser workers, without a separate writer pass - set for each run
+	bool fCompressedXml;		//The XML file is block-compressed, its index files are kept - set for each run
+	bool fKeepPageIndex;		//The page index file is written and kept - set for each run
 
 	//Number of cores to use settings
 	int numCores;
@@ -116,6 +119,8 @@ private slots:
 	void LicenseMenuItemClicked();
 	void GoToFolderClicked();
 	void EnsureNonemptyOtherCores();
+	void PageTimeBudgetClicked();
+	void LargePageSizeClicked();
 	
 private:
 	void SetNumCoreTexts();
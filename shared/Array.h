@@ -27,8 +27,13 @@
 #include <math.h>
 #include <algorithm>
 #include <functional>
+#include <type_traits>
+#include <utility>
+#include <string.h>
+#include <iterator>
 #include <BString.h>
 #include <Savable.h>
+#include <ThreadPool.h>
 
 #pragma warning(disable:4996)		//disable unsafe functions warning
 
@@ -65,7 +70,8 @@ public:
 
 public:
 	void CopyFromPointer(const theType* thePointer, intType numToCopy);
-	void SetVirtual(theType* thePointer, intType theSize);	//Makes array virtual
+	void SetVirtual(theType* thePointer, intType theSize);	//Makes array virtual - resizing it to a larger size makes it a regular array again
+	void ReleaseVirtual();									//Makes a virtual array an empty regular array
 	//Importing from a different type of array with default cast
 	template<class rhsType, class rhsIntType> void ImportFrom(const CHArray<rhsType, rhsIntType>& rhs);
 
@@ -171,6 +177,8 @@ public:
 	void SetNumPoints(intType num){if(num<=size) numPoints=num; else numPoints=size;}
 	inline void AddPoint(const theType& point);
 	void AddAndExtend(const theType& point, intType factor=2);		//Tries to add a point, extending the array by "factor" if necessary
+	void Append(const theType* source, intType count);				//Adds count points, extending the array as Reserve() does
+	void Reserve(intType minSize);		//Makes room for minSize points, keeping the points; grows at least twofold, so repeated calls are amortized
 	CHArray<theType, intType>& operator<< (const theType& point){AddAndExtend(point);return *this;}	//Same as AddAndExtend()
 	//Same as AddFromArray()
 	CHArray<theType, intType>& operator<< (const CHArray<theType, intType>& source) {AddFromArray(source);return *this;}	
@@ -261,11 +269,29 @@ public:
 	void RadixSort(bool fDescending=false);	//Stable non-comparison sort for any numerical data, relies on bit order - careful!
 	void RadixSortWithPerm(CHArray<intType,intType>& perm, bool fDescending=false);	//Sorts the array and produces a permutation needed for the sort
 
+	//Parallel sorting and permutation on the shared thread pool (ThreadPool.h), for large arrays
+	//Both sorts are stable: integral types are sorted with an LSD radix sort, other types with a merge sort
+	void ParallelSort(bool fDescending=false);
+	void ParallelSortPermutation(CHArray<intType,intType>& perm, bool fDescending=false) const;
+	void ParallelPermute(const CHArray<intType,intType>& permutation);	//Same result as Permute(), the permutation must not repeat indices
+
 private:	//Private auxilliary functions for radix sorting
 	void InternalRadixSort(CHArray<theType,intType>& copyArray, bool fDescending);
 	void InternalRadixSortWithPerm(CHArray<theType,intType>& copyArray,CHArray<intType,intType>& perm,
 										CHArray<intType,intType>& copyPerm, bool fDescending);
 
+private:	//Private auxilliary functions for parallel sorting
+	static const int parallelChunk = 32768;		//Points per job below which the parallel functions do not split the work
+
+	typedef std::integral_constant<bool, std::is_integral<theType>::value && !std::is_same<theType,bool>::value> RadixSortable;
+	void InternalParallelSort(bool fDescending, std::true_type);
+	void InternalParallelSort(bool fDescending, std::false_type);
+	void InternalParallelSortPermutation(CHArray<intType,intType>& perm, bool fDescending, std::true_type) const;
+	void InternalParallelSortPermutation(CHArray<intType,intType>& perm, bool fDescending, std::false_type) const;
+
+	template <class keyType> static void ParallelRadixSortKeys(keyType* keys, intType* perm, intType n);	//perm may be NULL
+	template <class elemType, class Compare> static void ParallelMergeSort(elemType* data, intType n, Compare comp);
+
 public:
 	void Reverse();											//Reverses the order of the elements
 	void SwitchElements(intType index1, intType index2);	//Switches the two elements
@@ -275,6 +301,22 @@ public:
 private:
 	void DeleteArray();
 
+	//Element transfer when the array is reallocated or appended to:
+	//memcpy for trivially copyable types, element by element (moving when reallocating) for others
+	static void MoveElements(theType* dest, theType* source, intType count)
+		{MoveElements(dest,source,count,std::is_trivially_copyable<theType>());}
+	static void MoveElements(theType* dest, theType* source, intType count, std::true_type)
+		{if(count>0) memcpy(dest,source,(size_t)count*sizeof(theType));}
+	static void MoveElements(theType* dest, theType* source, intType count, std::false_type)
+		{for(intType i=0;i<count;i++) dest[i]=std::move(source[i]);}
+
+	static void CopyElements(theType* dest, const theType* source, intType count)
+		{CopyElements(dest,source,count,std::is_trivially_copyable<theType>());}
+	static void CopyElements(theType* dest, const theType* source, intType count, std::true_type)
+		{if(count>0) memcpy(dest,source,(size_t)count*sizeof(theType));}
+	static void CopyElements(theType* dest, const theType* source, intType count, std::false_type)
+		{for(intType i=0;i<count;i++) dest[i]=source[i];}
+
 public:
 	//Apply a function to every element
 	CHArray<theType, intType>& Apply(std::function<theType(theType)> func);
@@ -892,7 +934,7 @@ void CHArray<theType,intType>::Histogram(theType start, theType end, intType num
 	{
 		if(arr[i]>end || arr[i]<start) continue;	//point out of bounds
 		bin=(intType)( (arr[i]-start) * invStep);
-		result.arr[bin] + =1;						//Adding (resType)1
+		result.arr[bin] += 1;						//Adding (resType)1
 	}
 
 }
@@ -1181,6 +1223,17 @@ void CHArray<theType,intType>::SetVirtual(theType* thePointer, intType theSize)
 	arr=thePointer;
 }
 
+template <class theType,class intType>
+void CHArray<theType,intType>::ReleaseVirtual()
+{
+	if(!fVirtual) return;
+
+	fVirtual=false;
+	arr=0;
+	size=0;
+	numPoints=0;
+}
+
 //Removes points that are the same as the preceding element - call on sorted arrays
 template <class theType,class intType>
 void CHArray<theType,intType>::RemoveRepetitions()
@@ -1551,8 +1604,9 @@ void CHArray<theType,intType>::Serialize(BArchive& archive)
 	}
 	else
 	{
-		intType newSize;
+		intType newSize=0;		//Stays 0 if the archive has ended
 		archive>>newSize;
+		ReleaseVirtual();		//A view of someone else's memory cannot be resized
 		ResizeArray(newSize,true);
 	}
 	archive.HandleArray(arr,numPoints);
@@ -1671,6 +1725,262 @@ void CHArray<theType,intType>::Permute(const CHArray<intType,intType>& permutati
 	for(intType i=0;i<numPoints;i++) arr[i]=interm.arr[permutation.arr[i]];
 }
 
+template <class theType,class intType>
+void CHArray<theType,intType>::ParallelSort(bool fDescending)
+{
+	if(numPoints<2) return;
+	InternalParallelSort(fDescending, RadixSortable());
+}
+
+template <class theType,class intType>
+void CHArray<theType,intType>::ParallelSortPermutation(CHArray<intType,intType>& perm, bool fDescending) const
+{
+	perm.ResizeIfSmaller(numPoints,true);
+	InternalParallelSortPermutation(perm, fDescending, RadixSortable());
+}
+
+//Gathers through a moved-out copy, so the points are not copied twice
+template <class theType,class intType>
+void CHArray<theType,intType>::ParallelPermute(const CHArray<intType,intType>& permutation)
+{
+	if(permutation.GetNumPoints()!=numPoints) return;
+
+	CHArray<theType,intType> interm(numPoints,true);
+	CThreadPool::ParallelFor(numPoints, parallelChunk, [&](long long begin, long long end)
+	{
+		MoveElements(interm.arr+begin, arr+begin, (intType)(end-begin));
+	});
+
+	CThreadPool::ParallelFor(numPoints, parallelChunk, [&](long long begin, long long end)
+	{
+		for(intType i=(intType)begin; i<(intType)end; i++) arr[i]=std::move(interm.arr[permutation.arr[i]]);
+	});
+}
+
+//Integral points are sorted as unsigned keys: the sign bit is flipped, and all bits are flipped for descending order
+template <class theType,class intType>
+void CHArray<theType,intType>::InternalParallelSort(bool fDescending, std::true_type)
+{
+	typedef typename std::make_unsigned<theType>::type keyType;
+	const keyType signBit = std::is_signed<theType>::value ? (keyType)((keyType)1 << (sizeof(keyType)*8-1)) : (keyType)0;
+	const keyType flip = fDescending ? (keyType)~signBit : signBit;
+
+	CHArray<keyType,intType> keys(numPoints,true);
+	CThreadPool::ParallelFor(numPoints, parallelChunk, [&](long long begin, long long end)
+	{
+		for(intType i=(intType)begin; i<(intType)end; i++) keys.arr[i]=(keyType)arr[i]^flip;
+	});
+
+	ParallelRadixSortKeys(keys.arr, (intType*)NULL, numPoints);
+
+	CThreadPool::ParallelFor(numPoints, parallelChunk, [&](long long begin, long long end)
+	{
+		for(intType i=(intType)begin; i<(intType)end; i++) arr[i]=(theType)(keyType)(keys.arr[i]^flip);
+	});
+}
+
+template <class theType,class intType>
+void CHArray<theType,intType>::InternalParallelSort(bool fDescending, std::false_type)
+{
+	if(fDescending) ParallelMergeSort(arr, numPoints, [](const theType& a, const theType& b)->bool{return a > b;});
+	else ParallelMergeSort(arr, numPoints, [](const theType& a, const theType& b)->bool{return a < b;});
+}
+
+template <class theType,class intType>
+void CHArray<theType,intType>::InternalParallelSortPermutation(CHArray<intType,intType>& perm, bool fDescending, std::true_type) const
+{
+	typedef typename std::make_unsigned<theType>::type keyType;
+	const keyType signBit = std::is_signed<theType>::value ? (keyType)((keyType)1 << (sizeof(keyType)*8-1)) : (keyType)0;
+	const keyType flip = fDescending ? (keyType)~signBit : signBit;
+
+	CHArray<keyType,intType> keys(numPoints,true);
+	CThreadPool::ParallelFor(numPoints, parallelChunk, [&](long long begin, long long end)
+	{
+		for(intType i=(intType)begin; i<(intType)end; i++)
+		{
+			keys.arr[i]=(keyType)arr[i]^flip;
+			perm.arr[i]=i;
+		}
+	});
+
+	ParallelRadixSortKeys(keys.arr, perm.arr, numPoints);
+}
+
+template <class theType,class intType>
+void CHArray<theType,intType>::InternalParallelSortPermutation(CHArray<intType,intType>& perm, bool fDescending, std::false_type) const
+{
+	perm.SetValToPointNum();
+
+	if(fDescending) ParallelMergeSort(perm.arr, numPoints, [this](const intType& a, const intType& b)->bool{return arr[a] > arr[b];});
+	else ParallelMergeSort(perm.arr, numPoints, [this](const intType& a, const intType& b)->bool{return arr[a] < arr[b];});
+}
+
+//LSD radix sort, one byte per pass; each job counts and scatters its own range of the keys
+//Passes over bytes that are the same in all keys are skipped
+template <class theType,class intType>
+template <class keyType>
+void CHArray<theType,intType>::ParallelRadixSortKeys(keyType* keys, intType* perm, intType n)
+{
+	if(n<2) return;
+
+	int numJobs = CThreadPool::NumJobs(n, parallelChunk);
+	auto Begin = [n,numJobs](int job)->intType {return (intType)(((long long)n*job)/numJobs);};
+
+	CHArray<keyType,int> diffs(numJobs,true);
+	CThreadPool::Run(numJobs, [&](int job)
+	{
+		keyType diff = 0;
+		for(intType i=Begin(job); i<Begin(job+1); i++) diff |= keys[i]^keys[0];
+		diffs[job] = diff;
+	});
+
+	keyType diff = 0;
+	for(int job=0; job<numJobs; job++) diff |= diffs[job];
+	if(diff==0) return;
+
+	bool fPerm = (perm != NULL);
+	CHArray<keyType,intType> keyCopy(n,true);
+	CHArray<intType,intType> permCopy(fPerm ? n : 0, true);
+
+	keyType* srcKeys = keys;
+	keyType* dstKeys = keyCopy.arr;
+	intType* srcPerm = perm;
+	intType* dstPerm = permCopy.arr;
+
+	CHArray<intType,int> offsets(numJobs*256,true);		//Per job and bucket: the count, then the next output position
+
+	for(int byte=0; byte<(int)sizeof(keyType); byte++)
+	{
+		int shift = byte*8;
+		if(((diff >> shift) & 0xff) == 0) continue;
+
+		CThreadPool::Run(numJobs, [&](int job)
+		{
+			intType* counts = offsets.arr + job*256;
+			for(int bucket=0; bucket<256; bucket++) counts[bucket]=0;
+			for(intType i=Begin(job); i<Begin(job+1); i++) counts[(srcKeys[i] >> shift) & 0xff]++;
+		});
+
+		//Buckets in order, and the jobs in order within a bucket - keeps the sort stable
+		intType pos = 0;
+		for(int bucket=0; bucket<256; bucket++)
+		{
+			for(int job=0; job<numJobs; job++)
+			{
+				intType count = offsets[job*256+bucket];
+				offsets[job*256+bucket] = pos;
+				pos += count;
+			}
+		}
+
+		CThreadPool::Run(numJobs, [&](int job)
+		{
+			intType* positions = offsets.arr + job*256;
+			for(intType i=Begin(job); i<Begin(job+1); i++)
+			{
+				intType dest = positions[(srcKeys[i] >> shift) & 0xff]++;
+				dstKeys[dest] = srcKeys[i];
+				if(fPerm) dstPerm[dest] = srcPerm[i];
+			}
+		});
+
+		std::swap(srcKeys,dstKeys);
+		std::swap(srcPerm,dstPerm);
+	}
+
+	//After an odd number of passes the result is in the copies
+	if(srcKeys != keys)
+	{
+		CThreadPool::ParallelFor(n, parallelChunk, [&](long long begin, long long end)
+		{
+			memcpy(keys+begin, srcKeys+begin, (size_t)(end-begin)*sizeof(keyType));
+			if(fPerm) memcpy(perm+begin, srcPerm+begin, (size_t)(end-begin)*sizeof(intType));
+		});
+	}
+}
+
+//Stable merge sort: one run per job is sorted with std::stable_sort, then pairs of runs are merged until one is left
+//Each merge is split into pieces at the same points of both runs, so all threads have work until the last merge
+template <class theType,class intType>
+template <class elemType, class Compare>
+void CHArray<theType,intType>::ParallelMergeSort(elemType* data, intType n, Compare comp)
+{
+	int numRuns = CThreadPool::NumJobs(n, parallelChunk);
+	if(numRuns<=1)
+	{
+		std::stable_sort(data, data+n, comp);
+		return;
+	}
+
+	int numThreads = numRuns;
+	CHArray<intType,int> bounds(numRuns+1,true);
+	for(int run=0; run<=numRuns; run++) bounds[run] = (intType)(((long long)n*run)/numRuns);
+
+	CThreadPool::Run(numRuns, [&](int run)
+	{
+		std::stable_sort(data+bounds[run], data+bounds[run+1], comp);
+	});
+
+	CHArray<elemType,intType> buffer(n,true);
+	elemType* src = data;
+	elemType* dst = buffer.arr;
+
+	while(numRuns>1)
+	{
+		int numPairs = (numRuns+1)/2;
+		int numPieces = std::max(1, numThreads/numPairs);
+
+		//The split points are found before merging, while the runs are intact
+		//Piece k of a pair merges A[aSplit(k), aSplit(k+1)) with the points of B that go between them
+		CHArray<intType,int> aSplits(numPairs*(numPieces+1),true);
+		CHArray<intType,int> bSplits(numPairs*(numPieces+1),true);
+		for(int pair=0; pair<numPairs; pair++)
+		{
+			intType aBegin = bounds[2*pair];
+			intType aEnd = bounds[std::min(2*pair+1,numRuns)];
+			intType bEnd = bounds[std::min(2*pair+2,numRuns)];
+
+			for(int piece=0; piece<=numPieces; piece++)
+			{
+				intType aSplit = aBegin + (intType)(((long long)(aEnd-aBegin)*piece)/numPieces);
+				intType bSplit;
+				if(piece==0) bSplit = aEnd;
+				else if(piece==numPieces || aSplit==aEnd) bSplit = bEnd;
+				else bSplit = (intType)(std::lower_bound(src+aEnd, src+bEnd, src[aSplit], comp) - src);
+
+				aSplits[pair*(numPieces+1)+piece] = aSplit;
+				bSplits[pair*(numPieces+1)+piece] = bSplit;
+			}
+		}
+
+		CThreadPool::Run(numPairs*numPieces, [&](int job)
+		{
+			int pair = job/numPieces;
+			int index = pair*(numPieces+1) + job%numPieces;
+			intType bBegin = bounds[std::min(2*pair+1,numRuns)];
+
+			intType a0 = aSplits[index], a1 = aSplits[index+1];
+			intType b0 = bSplits[index], b1 = bSplits[index+1];
+
+			std::merge(std::make_move_iterator(src+a0), std::make_move_iterator(src+a1),
+						std::make_move_iterator(src+b0), std::make_move_iterator(src+b1),
+						dst + a0 + (b0-bBegin), comp);
+		});
+
+		for(int pair=0; pair<=numPairs; pair++) bounds[pair] = bounds[std::min(2*pair,numRuns)];
+		numRuns = numPairs;
+		std::swap(src,dst);
+	}
+
+	if(src != data)
+	{
+		CThreadPool::ParallelFor(n, parallelChunk, [&](long long begin, long long end)
+		{
+			std::move(src+begin, src+end, data+begin);
+		});
+	}
+}
+
 template <class theType,class intType>	//Calculates inverse permutation, makes sense for <int> arrays
 void CHArray<theType,intType>::InvertPermutation()
 {
@@ -1867,10 +2177,31 @@ void CHArray<theType,intType>::AddAndExtend(const theType& point, intType factor
 template <class theType,class intType>
 void CHArray<theType,intType>::AddFromArray(const CHArray<theType,intType>& source)
 {
-	int newSize = Count() + source.Count();
-	if (newSize > Size()) ResizeArrayKeepPoints(newSize);
+	//Reserve first - source may be this array
+	Reserve(Count() + source.Count());
+	Append(source.arr, source.Count());
+}
+
+//source must not point into this array, unless Reserve() has made room for the points first
+template <class theType,class intType>
+void CHArray<theType,intType>::Append(const theType* source, intType count)
+{
+	if(count<=0) return;
+
+	Reserve(numPoints+count);
+
+	CopyElements(arr+numPoints,source,count);
+	numPoints+=count;
+}
+
+template <class theType,class intType>
+void CHArray<theType,intType>::Reserve(intType minSize)
+{
+	if(minSize<=size) return;
 
-	for (int i = 0; i < source.Count(); i++) AddPoint(source.arr[i]);
+	intType newSize=size*2;
+	if(newSize<minSize) newSize=minSize;
+	ResizeArrayKeepPoints(newSize);
 }
 
 //Add and extend from string
@@ -1994,7 +2325,11 @@ void CHArray<theType,intType>::RemoveAllPoinstAfter(intType num)
 template <class theType,class intType>
 void CHArray<theType,intType>::ResizeArray(intType newSize, bool fSetMaxNumPoints)
 {
-	if(fVirtual) return;
+	if(fVirtual)
+	{
+		if(size==newSize) return;
+		ReleaseVirtual();		//The viewed memory is not ours to reallocate
+	}
 
 	if(size!=newSize)
 	{
@@ -2011,7 +2346,11 @@ void CHArray<theType,intType>::ResizeArray(intType newSize, bool fSetMaxNumPoint
 template <class theType,class intType>
 void CHArray<theType,intType>::ResizeIfSmaller(intType newSize, bool fSetNumPoints)
 {
-	if(fVirtual) return;
+	if(fVirtual)
+	{
+		if(size>=newSize) return;
+		ReleaseVirtual();
+	}
 
 	if(size<newSize)
 	{
@@ -2028,18 +2367,19 @@ void CHArray<theType,intType>::ResizeIfSmaller(intType newSize, bool fSetNumPoin
 template <class theType,class intType>
 void CHArray<theType,intType>::ResizeArrayKeepPoints(intType newSize)
 {
-	if(fVirtual) return;
-
 	intType newPoints;
 	if(numPoints<newSize) newPoints=numPoints;
 	else newPoints=newSize;
 
 	theType* newArr=new theType[newSize];
 
-	for (intType i = 0; i<newPoints; i++) newArr[i] = arr[i];
+	//A virtual array is copied out of the memory it views, and becomes a regular array
+	if(fVirtual) CopyElements(newArr,arr,newPoints);
+	else MoveElements(newArr,arr,newPoints);
 
 	DeleteArray();
 
+	fVirtual=false;
 	size=newSize;
 	numPoints=newPoints;
 	arr=newArr;
@@ -2052,7 +2392,7 @@ CHArray<theType,intType>& CHArray<theType,intType>::operator=(const CHArray<theT
 {
 	if(this==&rhs) return *this;		//Avoiding self-assignment
 
-	if(size!=rhs.size) ResizeArray(rhs.size);
+	if(size!=rhs.size && !fVirtual) ResizeArray(rhs.size);	//A virtual array is copied into in place
 
 	if(!fVirtual) numPoints=rhs.numPoints;
 	intType numToCopy=std::min(numPoints,rhs.numPoints);
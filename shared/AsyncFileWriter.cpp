@@ -0,0 +1,213 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#include "AsyncFileWriter.h"
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+CAsyncFileWriter::CAsyncFileWriter(int64 theBufferSize/*=8*1024*1024*/, int theNumBuffers/*=4*/):
+	#ifdef _WIN32
+		fileHandle(INVALID_HANDLE_VALUE),
+	#else
+		fd(-1),
+	#endif
+	bufferSize(theBufferSize),
+	numBuffers(theNumBuffers < 2 ? 2 : theNumBuffers),
+	current(0),
+	totalBytes(0),
+	fStop(false),
+	fFailed(false)
+{
+	//Whole pages, so that all writes but the last start and end on page boundaries
+	bufferSize = ((bufferSize + 4095)/4096)*4096;
+	if(bufferSize <= 0) bufferSize = 4096;
+}
+
+CAsyncFileWriter::~CAsyncFileWriter()
+{
+	Close();
+}
+
+bool CAsyncFileWriter::Open(const BString& fileName)
+{
+	Close();
+
+	#ifdef _WIN32
+		fileHandle = CreateFileA(fileName, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	#else
+		fd = open(fileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	#endif
+	if(!IsOpen()) return false;
+
+	buffers.ResizeArray(numBuffers);
+	buffers.SetNumPoints(numBuffers);
+	for(int i=0;i<numBuffers;i++)
+	{
+		if(buffers[i].data.GetSize() < bufferSize) buffers[i].data.ResizeArray(bufferSize);
+		buffers[i].numBytes = 0;
+	}
+
+	current = 0;
+	totalBytes = 0;
+	fullBuffers.clear();
+	freeBuffers.clear();
+	for(int i=1;i<numBuffers;i++) freeBuffers.push_back(i);
+	fStop = false;
+	fFailed = false;
+
+	writer = boost::thread(&CAsyncFileWriter::WriterThread, this);
+	return true;
+}
+
+bool CAsyncFileWriter::Close()
+{
+	if(!IsOpen()) return true;
+
+	//The last, partly filled buffer
+	if(buffers[current].numBytes > 0) SubmitCurrent();
+
+	{
+		boost::mutex::scoped_lock lock(queueMutex);
+		fStop = true;
+	}
+	queueCondition.notify_all();
+	writer.join();
+
+	#ifdef _WIN32
+		CloseHandle(fileHandle);
+		fileHandle = INVALID_HANDLE_VALUE;
+	#else
+		close(fd);
+		fd = -1;
+	#endif
+
+	if(fFailed) std::cerr << "Error writing to file: not all data was written." << std::endl;
+	return !fFailed;
+}
+
+bool CAsyncFileWriter::IsOpen() const
+{
+	#ifdef _WIN32
+		return fileHandle != INVALID_HANDLE_VALUE;
+	#else
+		return fd != -1;
+	#endif
+}
+
+void CAsyncFileWriter::Write(const void* data, int64 numBytes)
+{
+	if(!IsOpen()) return;
+
+	const char* cur = (const char*)data;
+	totalBytes += numBytes;
+
+	while(numBytes > 0)
+	{
+		Buffer& buffer = buffers[current];
+		int64 toCopy = bufferSize - buffer.numBytes;
+		if(toCopy > numBytes) toCopy = numBytes;
+
+		memcpy(buffer.data.arr + buffer.numBytes, cur, (size_t)toCopy);
+		buffer.numBytes += toCopy;
+		cur += toCopy;
+		numBytes -= toCopy;
+
+		if(buffer.numBytes == bufferSize) SubmitCurrent();
+	}
+}
+
+//Hands the current buffer to the writer thread and takes a free one, waiting if there are none
+void CAsyncFileWriter::SubmitCurrent()
+{
+	boost::mutex::scoped_lock lock(queueMutex);
+
+	fullBuffers.push_back(current);
+	queueCondition.notify_all();
+
+	while(freeBuffers.empty()) queueCondition.wait(lock);
+	current = freeBuffers.front();
+	freeBuffers.pop_front();
+	buffers[current].numBytes = 0;
+}
+
+void CAsyncFileWriter::WriterThread()
+{
+	int64 offset = 0;
+
+	while(true)
+	{
+		int index;
+		{
+			boost::mutex::scoped_lock lock(queueMutex);
+			while(fullBuffers.empty() && !fStop) queueCondition.wait(lock);
+			if(fullBuffers.empty()) return;		//Stopped, and everything is written
+
+			index = fullBuffers.front();
+			fullBuffers.pop_front();
+		}
+
+		Buffer& buffer = buffers[index];
+		if(!fFailed && !WriteAt(buffer.data.arr, buffer.numBytes, offset)) fFailed = true;
+		offset += buffer.numBytes;
+
+		{
+			boost::mutex::scoped_lock lock(queueMutex);
+			freeBuffers.push_back(index);
+		}
+		queueCondition.notify_all();
+	}
+}
+
+//Positional write - does not depend on a file position
+bool CAsyncFileWriter::WriteAt(const char* data, int64 numBytes, int64 offset)
+{
+	while(numBytes > 0)
+	{
+		#ifdef _WIN32
+			DWORD chunk = (numBytes > 0x40000000) ? 0x40000000 : (DWORD)numBytes;
+			OVERLAPPED overlapped;
+			memset(&overlapped, 0, sizeof(overlapped));
+			overlapped.Offset = (DWORD)(offset & 0xFFFFFFFF);
+			overlapped.OffsetHigh = (DWORD)(offset >> 32);
+
+			DWORD numWritten = 0;
+			if(!WriteFile(fileHandle, data, chunk, &numWritten, &overlapped) || numWritten == 0) return false;
+		#else
+			ssize_t numWritten = pwrite(fd, data, (size_t)numBytes, (off_t)offset);
+			if(numWritten <= 0) return false;
+		#endif
+
+		data += numWritten;
+		offset += numWritten;
+		numBytes -= numWritten;
+	}
+
+	return true;
+}
@@ -0,0 +1,85 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "BString.h"
+#include "Array.h"
+#include "boost/thread.hpp"
+#include <deque>
+
+//Appends data to a file from a writer thread, so that the caller does not wait for the disk
+//Data is copied into large buffers; full buffers are written by the writer thread with positional writes
+//(pwrite, or WriteFile at an offset on Windows) while the caller fills the next buffer
+//At most numBuffers buffers exist - when all of them are waiting to be written, Write() blocks until one is free
+
+//Write() and Close() must not be called by several threads at the same time - the caller locks if needed
+
+class CAsyncFileWriter
+{
+public:
+	CAsyncFileWriter(int64 theBufferSize = 8*1024*1024, int theNumBuffers = 4);
+	~CAsyncFileWriter();
+
+public:
+	bool Open(const BString& fileName);		//Creates or truncates the file, returns false if it could not be opened
+	bool Close();							//Writes out all data and closes the file, returns false if any write failed
+
+	bool IsOpen() const;
+	void Write(const void* data, int64 numBytes);
+	int64 BytesWritten() const {return totalBytes;};	//Bytes passed to Write() since Open(), written out or not
+
+private:
+	struct Buffer
+	{
+		CHArray<char,int64> data;
+		int64 numBytes;
+	};
+
+	void WriterThread();
+	void SubmitCurrent();			//Hands the current buffer to the writer thread and takes a free one
+	bool WriteAt(const char* data, int64 numBytes, int64 offset);
+
+	#ifdef _WIN32
+		void* fileHandle;
+	#else
+		int fd;
+	#endif
+
+	int64 bufferSize;
+	int numBuffers;
+	CHArray<Buffer> buffers;
+	int current;					//Buffer being filled by Write()
+	int64 totalBytes;
+
+	boost::thread writer;
+	boost::mutex queueMutex;
+	boost::condition_variable queueCondition;
+	std::deque<int> fullBuffers;	//Waiting to be written, in file order - the writer thread keeps the offset
+	std::deque<int> freeBuffers;
+	bool fStop;
+	bool fFailed;
+
+	//Not copyable
+	CAsyncFileWriter(const CAsyncFileWriter&);
+	CAsyncFileWriter& operator=(const CAsyncFileWriter&);
+};
@@ -80,6 +80,7 @@ public:
 public:
 	bool IsStoring() const {return isStoring;};
 	bool IsLoading() const {return !isStoring;};
+	bool IsAtEnd() const {return !isStoring && inStream->peek() == std::char_traits<char>::eof();};	//Loading: nothing is left to read
 
 	//Store or retrieve a value
 	template<class theType>
@@ -20,22 +20,72 @@
 * IN THE SOFTWARE.
 */
 
+
 #pragma once
 #include "Array.h"
 #include "CAIStrings.h"
 #include <map>
+#include <functional>
 
 //Type-to-int bidirectional map
 //Cannot have more than 2^32 elements, so uses only CHArray<theType,int>
 
+//Two backends for the word -> index lookup, selectable per instance with SetBackend():
+//hashBackend (default) - open addressing table with robin hood probing
+//treeBackend - std::map, ordered by theType::operator<
+
+//The hash backend keeps the hash of every word in hashArr, so the table is rebuilt
+//from the arrays in linear time without hashing or comparing the words again
+//Each slot is a uint64: the word's 32-bit hash in the upper half and (index + 1), 0 - empty slot
+//The table is a power of two and at most 70% full
+
+//Hash functions for the hash backend
+template <class theType> struct CBidirectionalHash
+{
+	static uint Hash(const theType& val)
+	{
+		//std::hash of integers is the identity, so mix the bits
+		uint64 hash = (uint64)std::hash<theType>()(val);
+		hash ^= hash >> 33;
+		hash *= 0xff51afd7ed558ccdULL;
+		hash ^= hash >> 33;
+		return (uint)hash;
+	}
+};
+
+template <> struct CBidirectionalHash<BString>
+{
+	static uint Hash(const BString& val)
+	{
+		//FNV-1a with a final mix
+		const char* string = val.c_str();
+		int length = val.GetLength();
+
+		uint64 hash = 14695981039346656037ULL;
+		for(int i=0;i<length;i++)
+		{
+			hash ^= (unsigned char)string[i];
+			hash *= 1099511628211ULL;
+		}
+
+		hash ^= hash >> 29;
+		hash *= 0xbf58476d1ce4e5b9ULL;
+		hash ^= hash >> 32;
+		return (uint)hash;
+	}
+};
+
 template <class theType> class CBidirectionalMap : public Savable
 {
+public:
+	enum Backend {hashBackend, treeBackend};
+
 public:
 	CBidirectionalMap(int theMaxPoints=-1, bool fFrequencies=false);
-	CBidirectionalMap(CHArray<theType>& rhsArray, bool fFrequencies=false);	//Will call AddFromArray()
+	CBidirectionalMap(const CHArray<theType>& rhsArray, bool fFrequencies=false);	//Will call AddFromArray()
 	CBidirectionalMap(const BString& fileName, bool fArray=false, bool fFrequencies=false);	//Will call Load() if fArray==false
 																						//or LoadFromArray() if true
-	void CreateFromArray(CHArray<theType>& rhsArray);
+	void CreateFromArray(const CHArray<theType>& rhsArray);
 	~CBidirectionalMap(void){}
 
 public:
@@ -52,6 +102,9 @@ public:
 	bool IsFull() const {return wordArr.IsFull();}
 	bool IsEmpty() const {return wordArr.IsEmpty();}
 
+	void SetBackend(Backend theBackend);		//Rebuilds the lookup for the new backend, the words and indexes do not change
+	Backend GetBackend() const {return backend;}
+
 	//More proper names
 	bool Insert(const theType& val, int numTimes = 1){ return AddWord(val,numTimes); }
 	int InsertGetIndex(const theType& val, int numTimes = 1){ return AddWordGetIndex(val,numTimes); }
@@ -59,7 +112,8 @@ public:
     bool AddWord(const theType& newWord, int numTimes=1);
 	CBidirectionalMap<theType>& operator<<(const theType& newWord) { AddWord(newWord); return *this; }		//operator << adds a word
     int AddWordGetIndex(const theType& newWord, int numTimes=1);
-	void AddFromArray(CHArray<theType>& theArray, int numTimes=1);
+	int AddWordWithHash(const theType& newWord, uint hash, int numTimes=1);	//hash must be CBidirectionalHash<theType>::Hash(newWord)
+	void AddFromArray(const CHArray<theType>& theArray, int numTimes=1);
 	void AddFromMap(CBidirectionalMap<theType>& otherMap);
 	template<class intType> void AddBStringsFromCAIS(CAIStrings<char,intType>& strings, int numTimes=1);
 
@@ -68,7 +122,7 @@ public:
 	void Remove(const theType& val){ RemoveWord(val); }
 	void RemoveByIndex(int index){ RemoveWordByIndex(index); }
 
-	void RemoveWords(CBidirectionalMap<theType>& removeList, bool present=true);		//Removes words by re-composing the map
+	void RemoveWords(CBidirectionalMap<theType>& removeList, bool present=true);		//Removes words by compacting the arrays and rebuilding the lookup
     void RemoveWord(const theType& word);		//Removes a single word - O(N) because of word array shifting and decrementing in the map
 	void RemoveWordByIndex(int index);			//Removes a single word - O(N) because of word array shifting and decrementing in the map
     int GetFrequency(const theType& word);
@@ -89,7 +143,19 @@ public:
 	bool fFreq;						//if frequencies are counted for words being added
 	CHArray<int> freqArr;			//array of frequencies
 	CHArray<theType> wordArr;		//array of words - word stands for key values (theType) added to map
-	std::map<theType,int> map;			//mapping between words and numbers (indexes in array)
+	std::map<theType,int> map;			//mapping between words and numbers (indexes in array) - tree backend
+	CHArray<uint> hashArr;			//hashes of the words - hash backend
+	CHArray<uint64> slots;			//open addressing table - hash backend
+
+private:
+	Backend backend;
+
+	void RebuildIndex();						//Rebuilds the lookup from the word array
+	bool ReserveSlots(int numWords);			//Grows and refills the table if it cannot hold numWords, returns true if it did
+	void FillSlots();							//Inserts the words with stored hashes into an emptied table
+	void InsertSlot(uint hash, int index);
+	int FindSlot(const theType& word, uint hash) const;		//Position of the word's slot, -1 if not present
+	void EraseSlot(int pos);
 };
 
 template<>
@@ -109,20 +175,22 @@ void CBidirectionalMap<BString>::AddBStringsFromCAIS(CAIStrings<char,intType>& s
 
 template <class theType>
 CBidirectionalMap<theType>::CBidirectionalMap(int theMaxPoints, bool fFrequencies):
-fFreq(fFrequencies)
+fFreq(fFrequencies),
+backend(hashBackend)
 {
 	if (theMaxPoints > 0) Resize(theMaxPoints);
 }
 
 template <class theType>
-CBidirectionalMap<theType>::CBidirectionalMap(CHArray<theType>& rhsArray, bool fFrequencies):
-fFreq(fFrequencies)
+CBidirectionalMap<theType>::CBidirectionalMap(const CHArray<theType>& rhsArray, bool fFrequencies):
+fFreq(fFrequencies),
+backend(hashBackend)
 {
 	CreateFromArray(rhsArray);
 }
 
 template <class theType>
-void CBidirectionalMap<theType>::CreateFromArray(CHArray<theType>& rhsArray)
+void CBidirectionalMap<theType>::CreateFromArray(const CHArray<theType>& rhsArray)
 {
 	ResizeIfSmaller(rhsArray.Count());
 	Clear();
@@ -130,6 +198,19 @@ void CBidirectionalMap<theType>::CreateFromArray(CHArray<theType>& rhsArray)
 	AddFromArray(rhsArray);
 }
 
+template <class theType>
+void CBidirectionalMap<theType>::SetBackend(Backend theBackend)
+{
+	if(theBackend == backend) return;
+	backend = theBackend;
+
+	map.clear();
+	hashArr.ResizeArray(0);
+	slots.ResizeArray(0);
+
+	RebuildIndex();
+}
+
 template <class theType>
 void CBidirectionalMap<theType>::Resize(int newSize)
 {
@@ -137,28 +218,30 @@ void CBidirectionalMap<theType>::Resize(int newSize)
 	if(fFreq) freqArr.ResizeArray(newSize);
 
 	Clear();
+	if(backend == hashBackend) ReserveSlots(newSize);
 }
 
 template <class theType>
 void CBidirectionalMap<theType>::ResizeKeepPoints(int newSize)
 {
-	//Copy the data arrays
-	CHArray<theType> copyWords(wordArr);
-	CHArray<int> copyFreq(freqArr);
+	int oldCount = Count();
 
-	//Resize the map - erases the data
-	Resize(newSize);
+	//Words past newSize are dropped
+	wordArr.ResizeArrayKeepPoints(newSize);
+	if(fFreq) freqArr.ResizeArrayKeepPoints(newSize);
 
-	//Add the existing words back
-	for(int i=0; i < copyWords.Count() && i < newSize; i++)
+	if(backend == hashBackend)
 	{
-		if(fFreq) AddWord(copyWords[i],copyFreq[i]);
-		else AddWord(copyWords[i],1);
+		hashArr.ResizeArrayKeepPoints(newSize);
+		ReserveSlots(newSize);
 	}
+
+	if(Count() < oldCount) RebuildIndex();
 }
 
 template <class theType>
-CBidirectionalMap<theType>::CBidirectionalMap(const BString& fileName, bool fArray, bool fFrequencies)
+CBidirectionalMap<theType>::CBidirectionalMap(const BString& fileName, bool fArray, bool fFrequencies):
+backend(hashBackend)
 {
 	if(fArray) LoadFromArray(fileName,fFrequencies);
 	else Load(fileName);
@@ -179,24 +262,29 @@ void CBidirectionalMap<theType>::RemoveWords(CBidirectionalMap<theType>& removeL
 	//if present==true, removes entries present in removeList
 	//if present==false, removes entries not present in removeList
 
-	CHArray<theType> oldWordArr(wordArr);
-	CHArray<int> oldFreqArr(freqArr);
-	int oldNumPoints=Count();
-	Clear();
-
-	for(int i=0; i < oldNumPoints; i++)
+	//Compact the arrays in place, then rebuild the lookup once
+	int numKept=0;
+	for(int i=0; i < Count(); i++)
 	{
-		theType& word=oldWordArr[i];
-
-		bool condition=removeList.IsPresent(word);
+		bool condition=removeList.IsPresent(wordArr[i]);
 		if(present) condition=!condition;		//remove entries present in removeList if true
 
-		if(condition)
+		if(!condition) continue;
+
+		if(numKept != i)
 		{
-			AddWord(word);
-			if(fFreq) freqArr.AddAndExtend(oldFreqArr[i]);
+			wordArr[numKept]=wordArr[i];
+			if(fFreq) freqArr[numKept]=freqArr[i];
+			if(backend == hashBackend) hashArr[numKept]=hashArr[i];
 		}
+		numKept++;
 	}
+
+	wordArr.SetNumPoints(numKept);
+	if(fFreq) freqArr.SetNumPoints(numKept);
+	if(backend == hashBackend) hashArr.SetNumPoints(numKept);
+
+	RebuildIndex();
 }
 
 template <class theType>
@@ -221,13 +309,28 @@ void CBidirectionalMap<theType>::RemoveWordByIndex(int index)
 	//Slow operation - because the array needs to be shifted with each deletion
 	//And all indices above the given index decremented
 
-	map.erase(wordArr[index]);
+	if(backend == hashBackend)
+	{
+		EraseSlot(FindSlot(wordArr[index],hashArr[index]));
+		hashArr.RemovePointAt(index);
+
+		//Decrement the indexes in the table directly, without looking the words up
+		for(int i=0; i < slots.Count(); i++)
+		{
+			if((slots[i] & 0xffffffffULL) > (uint64)(index + 1)) slots[i]--;
+		}
+	}
+	else map.erase(wordArr[index]);
+
 	wordArr.RemovePointAt(index);
 	if(fFreq) freqArr.RemovePointAt(index);
-	
-	for(int i=index; i < Count(); i++)
+
+	if(backend == treeBackend)
 	{
-		map[wordArr[i]]=i;
+		for(int i=index; i < Count(); i++)
+		{
+			map[wordArr[i]]=i;
+		}
 	}
 }
 
@@ -237,20 +340,13 @@ void CBidirectionalMap<theType>::SortByFrequencies()
 	if(!fFreq) return;
 
 	CHArray<int> perm;
-	freqArr.SortPermutation(perm,true);
+	freqArr.SortPermutation(perm,true,true);		//Stable, words with equal frequencies keep their order
 
 	wordArr.Permute(perm);
 	freqArr.Permute(perm);
+	if(backend == hashBackend) hashArr.Permute(perm);
 
-	CHArray<theType> oldWordArr(wordArr);
-	CHArray<int> oldFreqArr(freqArr);
-
-	Clear();
-
-	for (int i = 0; i < oldWordArr.Count(); i++)
-	{
-		AddWord(oldWordArr[i],oldFreqArr[i]);
-	}
+	RebuildIndex();
 }
 
 template <class theType>
@@ -259,6 +355,10 @@ void CBidirectionalMap<theType>::Clear()
 	freqArr.Clear();
 	wordArr.Clear();
 	map.clear();
+
+	//The table keeps its size
+	hashArr.Clear();
+	for(int i=0; i < slots.Count(); i++) slots[i]=0;
 }
 
 template <class theType>
@@ -282,7 +382,7 @@ void CBidirectionalMap<theType>::Serialize(BArchive& ar)
 		if(!fFreq) freqArr.ResizeArray(0);
 
 		Resize(tempWordArr.Count());
-		
+
 		for(int i=0; i < tempWordArr.Count(); i++)
 		{
 			if(fFreq) AddWord(tempWordArr[i],tempFreqArr[i]);
@@ -292,7 +392,7 @@ void CBidirectionalMap<theType>::Serialize(BArchive& ar)
 }
 
 template <class theType>
-void CBidirectionalMap<theType>::AddFromArray(CHArray<theType>& theArray, int numTimes)
+void CBidirectionalMap<theType>::AddFromArray(const CHArray<theType>& theArray, int numTimes)
 {
 	int newSize = Count() + theArray.Count();
 	if(Size() < newSize ) ResizeKeepPoints(newSize);
@@ -306,10 +406,15 @@ void CBidirectionalMap<theType>::AddFromMap(CBidirectionalMap<theType>& otherMap
 	int numTotal = Count() + otherMap.Count();
 	if(Size() < numTotal) ResizeKeepPoints(numTotal);
 
+	//The other map's hashes can be reused
+	bool fHashes = (backend == hashBackend && otherMap.backend == hashBackend);
+
 	for(int i=0; i < otherMap.Count(); i++)
 	{
-		if(otherMap.fFreq) AddWord(otherMap.wordArr[i],otherMap.freqArr[i]);
-		else AddWord(otherMap.wordArr[i]);
+		int numTimes = otherMap.fFreq ? otherMap.freqArr[i] : 1;
+
+		if(fHashes) AddWordWithHash(otherMap.wordArr[i],otherMap.hashArr[i],numTimes);
+		else AddWord(otherMap.wordArr[i],numTimes);
 	}
 }
 
@@ -327,6 +432,8 @@ bool CBidirectionalMap<theType>::AddWord(const theType& newWord, int numTimes)
 template <class theType>
 int CBidirectionalMap<theType>::AddWordGetIndex(const theType& newWord, int numTimes)		//returns index
 {
+	if(backend == hashBackend) return AddWordWithHash(newWord, CBidirectionalHash<theType>::Hash(newWord), numTimes);
+
 	int index = GetIndex(newWord);
 	if(index != -1)	//word already there
 	{
@@ -342,13 +449,35 @@ int CBidirectionalMap<theType>::AddWordGetIndex(const theType& newWord, int numT
 	}
 }
 
+template <class theType>
+int CBidirectionalMap<theType>::AddWordWithHash(const theType& newWord, uint hash, int numTimes)
+{
+	if(backend == treeBackend) return AddWordGetIndex(newWord, numTimes);
+
+	int pos = FindSlot(newWord, hash);
+	if(pos != -1)	//word already there
+	{
+		int index = (int)(slots[pos] & 0xffffffffULL) - 1;
+		if(fFreq) freqArr[index]+=numTimes;
+		return index;
+	}
+
+	ReserveSlots(Count() + 1);
+	InsertSlot(hash, Count());
+
+	wordArr.AddAndExtend(newWord);
+	hashArr.AddAndExtend(hash);
+	if(fFreq) freqArr.AddAndExtend(numTimes);
+	return(Count()-1);
+}
+
 template <class theType>
 int CBidirectionalMap<theType>::GetFrequency(const theType& word)
 {
 	if(!fFreq) return 0;
 
 	int index = GetIndex(word);
-	if(index !=-1) return freqArr[index];	
+	if(index !=-1) return freqArr[index];
 	else return 0;
 }
 
@@ -368,6 +497,13 @@ void CBidirectionalMap<theType>::GetIndexForArrayOfWords(CHArray<theType>& words
 template <class theType>
 int CBidirectionalMap<theType>::GetIndex(const theType& word) const
 {
+	if(backend == hashBackend)
+	{
+		int pos = FindSlot(word, CBidirectionalHash<theType>::Hash(word));
+		if(pos == -1) return -1;
+		return (int)(slots[pos] & 0xffffffffULL) - 1;
+	}
+
 	auto it = map.find(word);
 	if(it!=map.end())	//word is found
 	{
@@ -382,3 +518,116 @@ bool CBidirectionalMap<theType>::IsPresent(const theType& word)
 	if(GetIndex(word) >= 0) return true;	//word is found
 	else return false;
 }
+
+template <class theType>
+void CBidirectionalMap<theType>::RebuildIndex()
+{
+	if(backend == treeBackend)
+	{
+		map.clear();
+		for(int i=0; i < Count(); i++) map[wordArr[i]]=i;
+		return;
+	}
+
+	//Hashes are only computed for words that do not have one yet
+	if(hashArr.Count() != Count())
+	{
+		if(hashArr.Size() < Size()) hashArr.ResizeArrayKeepPoints(Size());
+		for(int i=hashArr.Count(); i < Count(); i++) hashArr.AddPoint(CBidirectionalHash<theType>::Hash(wordArr[i]));
+	}
+
+	if(!ReserveSlots(Count())) FillSlots();
+}
+
+template <class theType>
+bool CBidirectionalMap<theType>::ReserveSlots(int numWords)
+{
+	if((int64)numWords * 10 <= (int64)slots.Count() * 7) return false;
+
+	int64 newSize = 16;
+	while(newSize * 7 < (int64)numWords * 10) newSize *= 2;
+
+	slots.ResizeArray((int)newSize, true);
+	FillSlots();
+	return true;
+}
+
+template <class theType>
+void CBidirectionalMap<theType>::FillSlots()
+{
+	for(int i=0; i < slots.Count(); i++) slots[i]=0;
+	for(int i=0; i < hashArr.Count() && i < Count(); i++) InsertSlot(hashArr[i], i);
+}
+
+template <class theType>
+void CBidirectionalMap<theType>::InsertSlot(uint hash, int index)
+{
+	//Robin hood: an entry further from its home slot takes the place of one that is closer to its own
+	int mask = slots.Count() - 1;
+	uint64 entry = ((uint64)hash << 32) | (uint64)(index + 1);
+	int pos = (int)(hash & (uint)mask);
+	int dist = 0;
+
+	while(true)
+	{
+		uint64 cur = slots[pos];
+		if(cur == 0)
+		{
+			slots[pos] = entry;
+			return;
+		}
+
+		int curDist = (pos - (int)((uint)(cur >> 32) & (uint)mask)) & mask;
+		if(curDist < dist)
+		{
+			slots[pos] = entry;
+			entry = cur;
+			dist = curDist;
+		}
+
+		pos = (pos + 1) & mask;
+		dist++;
+	}
+}
+
+template <class theType>
+int CBidirectionalMap<theType>::FindSlot(const theType& word, uint hash) const
+{
+	if(slots.IsEmpty()) return -1;
+
+	int mask = slots.Count() - 1;
+	int pos = (int)(hash & (uint)mask);
+	int dist = 0;
+
+	while(true)
+	{
+		uint64 cur = slots[pos];
+		if(cur == 0) return -1;
+
+		uint curHash = (uint)(cur >> 32);
+		if(curHash == hash && wordArr[(int)(cur & 0xffffffffULL) - 1] == word) return pos;
+
+		//The word would have displaced an entry closer to its home slot
+		if(((pos - (int)(curHash & (uint)mask)) & mask) < dist) return -1;
+
+		pos = (pos + 1) & mask;
+		dist++;
+	}
+}
+
+template <class theType>
+void CBidirectionalMap<theType>::EraseSlot(int pos)
+{
+	//Backward shift: entries after the erased one move back until an empty slot or an entry at its home slot
+	int mask = slots.Count() - 1;
+	int next = (pos + 1) & mask;
+
+	while(slots[next] != 0 && ((next - (int)((uint)(slots[next] >> 32) & (uint)mask)) & mask) != 0)
+	{
+		slots[pos] = slots[next];
+		pos = next;
+		next = (next + 1) & mask;
+	}
+
+	slots[pos] = 0;
+}
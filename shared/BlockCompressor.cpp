@@ -0,0 +1,205 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#include "BlockCompressor.h"
+#include <algorithm>
+#include <vector>
+
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+
+int64 CAISBlockIndex::BlockOf(int64 storagePos) const
+{
+	//Last block that starts at or before storagePos
+	int64 numBlocks = NumBlocks();
+	if(numBlocks == 0 || storagePos < storageStarts[0] || storagePos >= storageStarts[numBlocks]) return -1;
+
+	const int64* pos = std::upper_bound(storageStarts.arr, storageStarts.arr + numBlocks + 1, storagePos);
+	return (pos - storageStarts.arr) - 1;
+}
+
+CBlockCompressor::CBlockCompressor():
+	output(NULL),
+	maxJobs(0),
+	fStop(false),
+	fFailed(false),
+	fWriting(false)
+{
+}
+
+CBlockCompressor::~CBlockCompressor()
+{
+	Finish();
+}
+
+void CBlockCompressor::Start(CAsyncFileWriter* theOutput, int theNumThreads/*=0*/)
+{
+	Finish();
+
+	int numThreads = theNumThreads;
+	if(numThreads <= 0) numThreads = boost::thread::hardware_concurrency();
+	if(numThreads <= 0) numThreads = 1;
+
+	output = theOutput;
+	fileStarts.Clear();
+	maxJobs = 2*numThreads;
+	fStop = false;
+	fFailed = false;
+	fWriting = false;
+
+	for(int i=0;i<numThreads;i++) threads.create_thread(boost::bind(&CBlockCompressor::CompressorThread,this));
+}
+
+void CBlockCompressor::AddBlock(BString& block)
+{
+	if(!IsRunning()) return;
+
+	Job* job = new Job;
+	job->data.swap(block);
+	job->state = jobWaiting;
+
+	boost::mutex::scoped_lock lock(jobMutex);
+	while((int)jobs.size() >= maxJobs) jobCondition.wait(lock);
+
+	jobs.push_back(job);
+	jobCondition.notify_all();
+}
+
+bool CBlockCompressor::Finish()
+{
+	if(!IsRunning()) return true;
+
+	{
+		boost::mutex::scoped_lock lock(jobMutex);
+		while(!jobs.empty() || fWriting) jobCondition.wait(lock);
+		fStop = true;
+	}
+	jobCondition.notify_all();
+	threads.join_all();
+
+	fileStarts.AddAndExtend(output->BytesWritten());
+	output = NULL;
+
+	return !fFailed;
+}
+
+void CBlockCompressor::CompressorThread()
+{
+	BString compressed;
+
+	while(true)
+	{
+		Job* job = NULL;
+		{
+			boost::mutex::scoped_lock lock(jobMutex);
+			while(true)
+			{
+				for(size_t i=0;i<jobs.size();i++) if(jobs[i]->state == jobWaiting) {job = jobs[i]; break;}
+				if(job != NULL || fStop) break;
+				jobCondition.wait(lock);
+			}
+
+			if(job == NULL) return;
+			job->state = jobCompressing;
+		}
+
+		bool fCompressed = Compress(job->data.c_str(), job->data.size(), compressed);
+		job->data.swap(compressed);
+
+		boost::mutex::scoped_lock lock(jobMutex);
+		if(!fCompressed) fFailed = true;
+		job->state = jobDone;
+		WriteDoneJobs(lock);
+		jobCondition.notify_all();
+	}
+}
+
+//The jobs are taken off the queue under the lock and written after it is released, so the other threads keep compressing
+//Only one thread writes at a time - the others leave their finished jobs to it, which keeps the blocks in order
+void CBlockCompressor::WriteDoneJobs(boost::mutex::scoped_lock& lock)
+{
+	if(fWriting) return;
+	fWriting = true;
+
+	std::vector<Job*> done;
+	while(true)
+	{
+		done.clear();
+		while(!jobs.empty() && jobs.front()->state == jobDone)
+		{
+			done.push_back(jobs.front());
+			jobs.pop_front();
+		}
+		if(done.empty()) break;
+
+		jobCondition.notify_all();		//AddBlock() may be waiting for room in the queue
+
+		lock.unlock();
+		for(size_t i=0;i<done.size();i++)
+		{
+			fileStarts.AddAndExtend(output->BytesWritten());
+			output->Write(done[i]->data.c_str(), done[i]->data.size());
+			delete done[i];
+		}
+		lock.lock();
+	}
+
+	fWriting = false;
+}
+
+bool CBlockCompressor::Compress(const char* data, int64 numBytes, BString& result)
+{
+	result.clear();
+
+	try
+	{
+		boost::iostreams::filtering_ostream stream;
+		stream.push(boost::iostreams::zlib_compressor(boost::iostreams::zlib::best_speed));
+		stream.push(boost::iostreams::back_inserter(result));
+		stream.write(data, numBytes);
+		stream.reset();		//Flushes the compressor
+	}
+	catch(...)
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool CBlockCompressor::Decompress(const char* data, int64 numBytes, char* dest, int64 destSize)
+{
+	try
+	{
+		boost::iostreams::filtering_istream stream;
+		stream.push(boost::iostreams::zlib_decompressor());
+		stream.push(boost::iostreams::array_source(data, (size_t)numBytes));
+		stream.read(dest, destSize);
+		return stream.gcount() == destSize;
+	}
+	catch(...)
+	{
+		return false;
+	}
+}
@@ -0,0 +1,108 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "BString.h"
+#include "Array.h"
+#include "Savable.h"
+#include "AsyncFileWriter.h"
+#include "boost/thread.hpp"
+#include <deque>
+
+//Block-compressed CAIS storage:
+//Elements are grouped into blocks of about 1 MB, each block is compressed separately (zlib, fastest level)
+//The storage file holds the compressed blocks one after another
+//The block index records where each block starts in the uncompressed storage and in the file,
+//so a single element is read by decompressing only its block
+//Elements never straddle blocks
+
+//The codec is zlib rather than LZ4 or zstd: neither is vendored in this tree, while zlib comes with boost::iostreams,
+//which the parser already uses for bzip2 input. Compress() and Decompress() are the only places that know the codec
+
+class CAISBlockIndex : public Savable
+{
+public:
+	//The block index is kept next to the initial index array file
+	static BString FileFor(const BString& initIndexFile) {return initIndexFile + ".blocks";};
+
+	int64 NumBlocks() const {return storageStarts.Count() > 0 ? storageStarts.Count() - 1 : 0;};
+	int64 BlockOf(int64 storagePos) const;		//The block that contains storagePos, -1 if none
+
+	void Clear() {storageStarts.Clear(); fileStarts.Clear();};
+	void Serialize(BArchive& ar) {storageStarts.Serialize(ar); fileStarts.Serialize(ar);};
+
+public:
+	CHArray<int64,int64> storageStarts;		//Block starts in the uncompressed storage, in CAIS elements (iia units), plus the end
+	CHArray<int64,int64> fileStarts;		//Block starts in the storage file, in bytes, plus the end
+};
+
+//Compresses blocks on several threads and writes them to the output in the order they were added
+//AddBlock() blocks while too many blocks are waiting, so memory use stays bounded
+
+class CBlockCompressor
+{
+public:
+	CBlockCompressor();
+	~CBlockCompressor();
+
+public:
+	//Blocks are written to output starting at its current end
+	void Start(CAsyncFileWriter* theOutput, int theNumThreads = 0);		//0 - one thread per core
+	void AddBlock(BString& block);		//Takes the contents of block, leaves it empty
+	bool Finish();						//Waits for all blocks to be written, returns false if any could not be compressed
+
+	bool IsRunning() const {return output != NULL;};
+	const CHArray<int64,int64>& FileStarts() const {return fileStarts;};	//Where each block was written, plus the end
+
+	//zlib codec used for the blocks
+	static bool Compress(const char* data, int64 numBytes, BString& result);
+	static bool Decompress(const char* data, int64 numBytes, char* dest, int64 destSize);	//destSize must be the uncompressed size
+
+private:
+	enum JobState {jobWaiting, jobCompressing, jobDone};
+
+	struct Job
+	{
+		BString data;
+		JobState state;
+	};
+
+	void CompressorThread();
+	void WriteDoneJobs(boost::mutex::scoped_lock& lock);	//Writes the finished jobs at the front of the queue, called under the lock
+
+	CAsyncFileWriter* output;
+	CHArray<int64,int64> fileStarts;
+	int maxJobs;
+
+	boost::thread_group threads;
+	boost::mutex jobMutex;
+	boost::condition_variable jobCondition;
+	std::deque<Job*> jobs;		//In file order
+	bool fStop;
+	bool fFailed;
+	bool fWriting;				//A thread is writing jobs it has taken off the queue
+
+	//Not copyable
+	CBlockCompressor(const CBlockCompressor&);
+	CBlockCompressor& operator=(const CBlockCompressor&);
+};
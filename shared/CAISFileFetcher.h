@@ -21,9 +21,12 @@
 */
 
 #pragma once
-#include "fseek_large.h"
+#include "MappedFile.h"
 #include "Array.h"
-#include "boost/thread.hpp"			//Needs locking for multiple threads accessing the file and stringBuffer
+#include "BlockCompressor.h"
+#include "boost/thread/tss.hpp"
+#include <cstring>
+#include <fstream>
 
 //Class for rapid access to CAIS
 //Without loading the CAIS storage array into memory
@@ -36,33 +39,64 @@
 //When with two file names, accesses a CAIS file stored separately:
 //Storage data (plain data, not a serialized CHArray) and the initial index array (serialized)
 
-//Can read about 4000 fragments per second on an SSD
+//The storage is memory-mapped, or read with positional reads if it cannot be mapped
+//No locks are taken - any number of threads can read from one fetcher at the same time,
+//so random fetches are limited by the device rather than by the fetcher
+
+//If a block index is found next to the IIA (written by CAISSplitWriter with block compression),
+//the storage is block-compressed: an element is read by decompressing its block
+//Each thread keeps its last decompressed block, so sequential reads decompress every block once
 
 template <class theType, class intType=int> class CAISFileFetcher
 {
 public:
 	CAISFileFetcher(const BString& fileName);										//Access to a serialized CAIS file
 	CAISFileFetcher(const BString& storageFile, const BString& initIndexFile);		//Access to CAIS stored separately - storage data and IIA
-	~CAISFileFetcher(void);
+	~CAISFileFetcher(void){};
 
 //Get element functions
 public:
 
-	template <class argIntType> void GetElementAt(intType index, CHArray<theType,argIntType>& result);
-	void GetCharStringAt(intType index, BString& result);		//retrieves a char string stored with a terminating zero or without
+	template <class argIntType> void GetElementAt(intType index, CHArray<theType,argIntType>& result) const;
+	void GetCharStringAt(intType index, BString& result) const;		//retrieves a char string stored with a terminating zero or without
 	intType Count() const;
 
+	//Zero-copy view of an element in the mapped storage, valid as long as the fetcher exists
+	//Returns NULL if the storage is not mapped or is compressed - GetElementAt() still works then
+	//Also returns NULL, with elemSize 0, if the index points outside the storage - a truncated or corrupt file
+	const theType* GetElementView(intType index, intType& elemSize) const;
+
+	bool IsCompressed() const {return !blockIndex.storageStarts.IsEmpty();};
+
+	//Hints for reading the storage - read-ahead for sequential scans, no read-ahead for random fetches
+	void AdviseSequential() const {file.Advise(CMappedFile::accessSequential);};
+	void AdviseRandom() const {file.Advise(CMappedFile::accessRandom);};
+
 private:
-	FILE* fp;								//file is opened in constructor, closed in destructor
+	bool ReadStorage(intType startPos, intType elemSize, theType* dest) const;		//Reads elemSize elements at startPos
+	bool IsInStorage(intType startPos, intType elemSize) const;		//Whether the elements are in the file, or in one compressed block
+	const theType* BlockView(intType startPos) const;		//Compressed storage: startPos in this thread's decompressed block
+
+	struct DecompressedBlock
+	{
+		DecompressedBlock():index(-1){};
+		int64 index;
+		CHArray<theType,int64> data;
+		BString compressed;			//Read buffer if the file is not mapped
+	};
+
+	CMappedFile file;						//file is opened in constructor, closed in destructor
 	int64 storageStart;						//offset in the file where the storage array starts
 	CHArray<intType,intType> initIndexArr;	//initial index array is held in memory, storage is not
-	CHArray<char,int64> stringBuffer;		//buffer to copy chars into when a BString is requested - avoid allocating each time
-	boost::recursive_mutex mutex;
+
+	CAISBlockIndex blockIndex;				//Empty if the storage is not compressed
+	mutable boost::thread_specific_ptr<DecompressedBlock> lastBlock;
 };
 
 //Access to a serialized CAIS file
 template <class theType, class intType>
-CAISFileFetcher<theType,intType>::CAISFileFetcher(const BString& fileName)
+CAISFileFetcher<theType,intType>::CAISFileFetcher(const BString& fileName):
+storageStart(0)
 {
 	//Layout of the CAIStrings file on disk:
 
@@ -72,33 +106,28 @@ CAISFileFetcher<theType,intType>::CAISFileFetcher(const BString& fileName)
 	//init index array elements		(intType * initCount)
 
 	//Open the file
-	fp=fopen(fileName,"rb");		//Open as binary
-	if(fp==NULL)
+	if(!file.Open(fileName))
 	{
 		BString message="Could not open: "+fileName+".";
 		std::cerr << message << std::endl;
 		return;
 	}
 
-	////Seek to the start of file
-	fseek_large(fp,0,SEEK_SET);
-
 	//Read the number of points in the storage array and define the storage start
-	intType storageCount;
-	fread(&storageCount,sizeof(intType),1,fp);
+	intType storageCount=0;
+	file.Read(0,sizeof(intType),&storageCount);
 	storageStart=sizeof(intType);
 	
-	//Seek past the end of storage - this is where the initial index array is stored
-	fseek_large(fp, storageStart + sizeof(theType)*storageCount, SEEK_SET);
+	//The initial index array is stored past the end of storage
+	int64 initStart=storageStart + sizeof(theType)*(int64)storageCount;
 
-	//Read the number of points in the initial index array and seek back to the end of storage
-	intType initCount;
-	fread(&initCount,sizeof(intType),1,fp);
-	fseek_large(fp, storageStart + sizeof(theType)*storageCount, SEEK_SET);
+	//Read the number of points in the initial index array
+	intType initCount=0;
+	if(!file.Read(initStart,sizeof(intType),&initCount)) return;
 
 	//Read the initial index array into a char buffer
 	CHArray<char,intType> buffer(sizeof(intType)*(initCount+1));
-	fread(buffer.arr,sizeof(intType),initCount+1,fp);
+	if(!file.Read(initStart,sizeof(intType)*(int64)(initCount+1),buffer.arr)) return;
 
 	//Fill initIndexArr from the char buffer
 	char* bufferStart=buffer.arr;					//Deserialization will move the pointer, can't use buffer.arr
@@ -109,57 +138,160 @@ CAISFileFetcher<theType,intType>::CAISFileFetcher(const BString& fileName)
 //Data file (not a serialized CHArray, just data)
 //And the initial index array (serialized CHArray)
 template <class theType, class intType>
-CAISFileFetcher<theType,intType>::CAISFileFetcher(const BString& storageFile, const BString& initIndexFile)
+CAISFileFetcher<theType,intType>::CAISFileFetcher(const BString& storageFile, const BString& initIndexFile):
+storageStart(0)
 {
 	//Open the storage file
-	fp=fopen(storageFile,"rb");		//Open as binary
-	if(fp==NULL)
+	if(!file.Open(storageFile))
 	{
 		BString message="Could not open: "+storageFile+".";
 		std::cerr << message << std::endl;
 		return;
 	}
 
-	storageStart = 0;
 	initIndexArr.Load(initIndexFile);
+
+	//Block-compressed storage
+	BString blockIndexFile = CAISBlockIndex::FileFor(initIndexFile);
+	std::ifstream blockIndexStream(blockIndexFile);
+	if(blockIndexStream)
+	{
+		blockIndexStream.close();
+		blockIndex.Load(blockIndexFile);
+
+		if(blockIndex.fileStarts.Count() != blockIndex.storageStarts.Count())
+		{
+			std::cerr << "Invalid block index: " << blockIndexFile << std::endl;
+			blockIndex.Clear();
+		}
+	}
 }
 
+//Whether elemSize elements at startPos lie within the storage (within one block when compressed)
 template <class theType, class intType>
-CAISFileFetcher<theType,intType>::~CAISFileFetcher()
+bool CAISFileFetcher<theType,intType>::IsInStorage(intType startPos, intType elemSize) const
 {
-	boost::recursive_mutex::scoped_lock lock(mutex);
-	fclose(fp);
+	if(startPos < 0 || elemSize < 0) return false;
+
+	if(!IsCompressed()) return storageStart + (int64)(sizeof(theType)*((int64)startPos + elemSize)) <= file.Size();
+
+	int64 block = blockIndex.BlockOf(startPos);
+	return block >= 0 && (int64)startPos + elemSize <= blockIndex.storageStarts[block+1];
 }
 
+//Reads elemSize elements at startPos from the storage
 template <class theType, class intType>
-template <class argIntType>
-void CAISFileFetcher<theType,intType>::GetElementAt(intType index, CHArray<theType,argIntType>& result)
+bool CAISFileFetcher<theType,intType>::ReadStorage(intType startPos, intType elemSize, theType* dest) const
 {
-	boost::recursive_mutex::scoped_lock lock(mutex);
+	if(elemSize == 0) return true;
+	if(!IsInStorage(startPos, elemSize)) return false;
+
+	if(!IsCompressed()) return file.Read(storageStart + sizeof(theType)*(int64)startPos, sizeof(theType)*(int64)elemSize, dest);
+
+	const theType* view = BlockView(startPos);
+	if(view == NULL) return false;
+
+	memcpy(dest, view, sizeof(theType)*(size_t)elemSize);
+	return true;
+}
+
+//Elements never straddle blocks, so the whole element is in the block that holds its start
+template <class theType, class intType>
+const theType* CAISFileFetcher<theType,intType>::BlockView(intType startPos) const
+{
+	int64 block = blockIndex.BlockOf(startPos);
+	if(block < 0) return NULL;
+
+	DecompressedBlock* cache = lastBlock.get();
+	if(cache == NULL)
+	{
+		cache = new DecompressedBlock;
+		lastBlock.reset(cache);
+	}
 
+	if(cache->index != block)
+	{
+		cache->index = -1;
+
+		int64 blockStart = blockIndex.storageStarts[block];
+		int64 blockSize = blockIndex.storageStarts[block+1] - blockStart;
+		int64 fileStart = blockIndex.fileStarts[block];
+		int64 compressedSize = blockIndex.fileStarts[block+1] - fileStart;
+
+		const char* compressed;
+		if(file.IsMapped())
+		{
+			if(fileStart + compressedSize > file.Size()) return NULL;
+			compressed = file.Data() + fileStart;
+		}
+		else
+		{
+			cache->compressed.resize((size_t)compressedSize);
+			if(compressedSize > 0 && !file.Read(fileStart, compressedSize, &cache->compressed[0])) return NULL;
+			compressed = cache->compressed.c_str();
+		}
+
+		if(cache->data.GetSize() < blockSize) cache->data.ResizeArray(blockSize);
+		if(!CBlockCompressor::Decompress(compressed, compressedSize, (char*)cache->data.arr, sizeof(theType)*blockSize)) return NULL;
+		cache->data.SetNumPoints(blockSize);
+		cache->index = block;
+	}
+
+	return cache->data.arr + (startPos - blockIndex.storageStarts[block]);
+}
+
+template <class theType, class intType>
+const theType* CAISFileFetcher<theType,intType>::GetElementView(intType index, intType& elemSize) const
+{
+	elemSize=initIndexArr[index+1]-initIndexArr[index];
+	if(!IsInStorage(initIndexArr[index], elemSize)) {elemSize=0;return NULL;}
+	if(!file.IsMapped() || IsCompressed()) return NULL;
+
+	return (const theType*)(file.Data() + storageStart + sizeof(theType)*(int64)initIndexArr[index]);
+}
+
+template <class theType, class intType>
+template <class argIntType>
+void CAISFileFetcher<theType,intType>::GetElementAt(intType index, CHArray<theType,argIntType>& result) const
+{
 	intType startPos=initIndexArr[index];
 	intType endPos=initIndexArr[index+1];
 	intType elemSize=endPos-startPos;
+	if(!IsInStorage(startPos, elemSize)) {result.SetNumPoints(0);return;}
 
 	if((intType)result.GetSize()<(elemSize+1)) result.ResizeArray((argIntType)(elemSize+1));
 
-	result.SetNumPoints((argIntType)elemSize);
-
-	//Seek to where the element starts
-	fseek_large(fp, storageStart + sizeof(theType)*startPos, SEEK_SET);
-	
 	//Read into the array
-	fread(result.arr,sizeof(theType),elemSize,fp);
+	if(ReadStorage(startPos, elemSize, result.arr)) result.SetNumPoints((argIntType)elemSize);
+	else result.SetNumPoints(0);
 }
 
 template <class theType, class intType>
-void CAISFileFetcher<theType,intType>::GetCharStringAt(intType index, BString& result)
+void CAISFileFetcher<theType,intType>::GetCharStringAt(intType index, BString& result) const
 {
-	boost::recursive_mutex::scoped_lock lock(mutex);
+	intType elemSize;
+	const theType* view=GetElementView(index,elemSize);
+	int64 numBytes=sizeof(theType)*(int64)elemSize;
+
+	if(view!=NULL)
+	{
+		//Up to the terminating zero, if there is one
+		const char* string=(const char*)view;
+		const char* zero=(const char*)memchr(string,0,(size_t)numBytes);
+		if(zero!=NULL) numBytes=zero-string;
+
+		result.assign(string,(size_t)numBytes);
+		return;
+	}
+
+	//Not mapped or compressed - read straight into the string
+	result.resize((size_t)numBytes);
+	if(numBytes==0) return;
+
+	if(!ReadStorage(initIndexArr[index], elemSize, (theType*)&result[0])) {result.clear();return;}
 
-	GetElementAt(index,stringBuffer);
-	stringBuffer.AddAndExtend(0);
-	result=stringBuffer.arr;
+	size_t zero=result.find('\0');
+	if(zero!=std::string::npos) result.resize(zero);
 }
 
 template <class theType, class intType>
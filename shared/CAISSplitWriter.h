@@ -22,16 +22,22 @@
 
 #pragma once
 #include "Array.h"
+#include "AsyncFileWriter.h"
+#include "BlockCompressor.h"
 
 #include "boost/thread.hpp"			//Needs locking for multiple threads accessing the file and stringBuffer
 #include <iostream>
-#include <fstream>
+#include <cstdio>
 
 //A class to write a CAIStrings to two separate files:
 //a storage file (not a serialized array, just data)
 //and an initial index array file (a serialized CHArray)
 
 //By writing continuously to the data file, storage of large volumes in memory can be avoided
+//The data is written by a background thread (CAsyncFileWriter), so AddElement() only copies it into a buffer
+
+//Optionally, the storage is block-compressed (see BlockCompressor.h): call SetBlockCompression() before Open()
+//SaveInitIndex() then also saves the block index next to the iia, and CAISFileFetcher reads the storage transparently
 
 //Usage:
 //Call Open(BString& file) to open a new storage file
@@ -42,8 +48,8 @@
 template <class theType, class intType=int> class CAISSplitWriter
 {
 public:
-	CAISSplitWriter(){};
-	CAISSplitWriter(const BString& storageFile){Open(storageFile);};		//Will call open
+	CAISSplitWriter():blockSize(0),numCompressionThreads(0){};
+	CAISSplitWriter(const BString& storageFile):blockSize(0),numCompressionThreads(0){Open(storageFile);};		//Will call open
 	~CAISSplitWriter(void){};
 
 public:
@@ -52,9 +58,18 @@ public:
 	//Correspondingly, the file and the iia can still be read with a CAISFileFetcher
 	//The prepended string is not seen by the CAISSplitWriter and CAISFileFetcher at all after it has been added
 	bool Open(const BString& storageFile, const BString& prependToFile = "");
-	void Close();
+	bool Close();			//Returns false if not all data could be written
 	void Clear();
 
+	//Block size in bytes, 0 - no compression; numThreads = 0 - one compression thread per core
+	//The prepended string is not compressed
+	void SetBlockCompression(int64 theBlockSize, int numThreads = 0)
+	{
+		boost::recursive_mutex::scoped_lock lock(mutex);
+		blockSize = theBlockSize;
+		numCompressionThreads = numThreads;
+	};
+
 	intType Count()
 	{
 		boost::recursive_mutex::scoped_lock lock(mutex);
@@ -63,11 +78,7 @@ public:
 		else return res;
 	}
 
-	bool SaveInitIndex(const BString& initIndexFile)
-	{
-		boost::recursive_mutex::scoped_lock lock(mutex);
-		return initIndexArr.Save(initIndexFile);
-	};
+	bool SaveInitIndex(const BString& initIndexFile);
 
 public:
 	intType StorageSize()
@@ -83,7 +94,15 @@ public:
 	{
 		boost::recursive_mutex::scoped_lock lock(mutex);
 
-		storageStream.write((const char*)arr, sizeof(theType) * num);
+		if(compressor.IsRunning())
+		{
+			currentBlock.append((const char*)arr, sizeof(theType) * num);
+			initIndexArr.AddAndExtend(initIndexArr.Last() + num);
+			if((int64)currentBlock.size() >= blockSize) SubmitBlock();
+			return;
+		}
+
+		storageWriter.Write(arr, sizeof(theType) * num);
 		initIndexArr.AddAndExtend(initIndexArr.Last() + num);
 	};
 
@@ -104,16 +123,42 @@ public:
 	}
 	
 private:
-	std::ofstream storageStream;					//storage data is dumped to disk into this stream
+	void SubmitBlock();
+
+	CAsyncFileWriter storageWriter;			//storage data is dumped to disk through this writer
 	CHArray<intType,intType> initIndexArr;	//initial index array is held in memory, storage is not
 	boost::recursive_mutex mutex;
+
+	//Block compression
+	int64 blockSize;
+	int numCompressionThreads;
+	CBlockCompressor compressor;
+	BString currentBlock;					//Elements added since the last block was submitted
+	CAISBlockIndex blockIndex;
 };
 
+//Hands the current block to the compressor
+template <class theType, class intType>
+void CAISSplitWriter<theType,intType>::SubmitBlock()
+{
+	compressor.AddBlock(currentBlock);
+	blockIndex.storageStarts.AddAndExtend(initIndexArr.Last());
+}
+
 template <class theType, class intType>
-void CAISSplitWriter<theType,intType>::Close()
+bool CAISSplitWriter<theType,intType>::Close()
 {
 	boost::recursive_mutex::scoped_lock lock(mutex);
-	if(storageStream) storageStream.close();
+
+	bool fResult = true;
+	if(compressor.IsRunning())
+	{
+		if(!currentBlock.empty()) SubmitBlock();
+		fResult = compressor.Finish();
+		blockIndex.fileStarts = compressor.FileStarts();
+	}
+
+	return storageWriter.Close() && fResult;
 }
 
 template <class theType, class intType>
@@ -122,6 +167,7 @@ void CAISSplitWriter<theType,intType>::Clear()
 	boost::recursive_mutex::scoped_lock lock(mutex);
 	Close();
 	initIndexArr.Clear();
+	blockIndex.Clear();
 }
 
 template <class theType, class intType>
@@ -129,10 +175,8 @@ bool CAISSplitWriter<theType,intType>::Open(const BString& storageFile, const BS
 {
 	boost::recursive_mutex::scoped_lock lock(mutex);
 
-	if(storageStream) storageStream.close();
-	storageStream.open(storageFile, std::ios_base::binary);
-
-	if(!storageStream)
+	Close();
+	if(!storageWriter.Open(storageFile))
 	{
 		std::cerr << "Could not open file for writing: " << storageFile << std::endl;
 		return false;
@@ -142,10 +186,34 @@ bool CAISSplitWriter<theType,intType>::Open(const BString& storageFile, const BS
 
 	if(prependToFile != "")
 	{
-		storageStream.write(prependToFile,prependToFile.GetLength());
+		storageWriter.Write((const char*)prependToFile,prependToFile.GetLength());
 		initIndexArr.AddAndExtend(prependToFile.GetLength());
 	}
 	else initIndexArr.AddAndExtend(0);
 
+	blockIndex.Clear();
+	currentBlock.clear();
+	if(blockSize > 0)
+	{
+		blockIndex.storageStarts.AddAndExtend(initIndexArr.Last());
+		compressor.Start(&storageWriter, numCompressionThreads);
+	}
+
 	return true;
 }
+
+template <class theType, class intType>
+bool CAISSplitWriter<theType,intType>::SaveInitIndex(const BString& initIndexFile)
+{
+	boost::recursive_mutex::scoped_lock lock(mutex);
+
+	//The block index is complete only when all blocks have been written
+	if(compressor.IsRunning()) Close();
+
+	//A block index left over from an earlier compressed run would make the fetcher misread the storage
+	BString blockIndexFile = CAISBlockIndex::FileFor(initIndexFile);
+	if(blockIndex.storageStarts.IsEmpty()) std::remove(blockIndexFile);
+	else if(!blockIndex.Save(blockIndexFile)) return false;
+
+	return initIndexArr.Save(initIndexFile);
+}
@@ -143,14 +143,15 @@ void CAIStrings<theType,intType>::BuildIndex(CAIStrings<theType,intType>& freqCA
 	freqCAIS.ResizeIfSmaller((intType)primaryIndices.Count(),(intType)numPrimaryIndices);
 
 	//Sort first by secondary indices, then with stable sort by primary indices
+	//Both sorts and permutations run on the shared thread pool
 	CHArray<argIntType,argIntType> perm;
-	secondaryIndices.SortPermutation(perm,false,false);		//Regular sort
-	secondaryIndices.Permute(perm);
-	primaryIndices.Permute(perm);
+	secondaryIndices.ParallelSortPermutation(perm);
+	secondaryIndices.ParallelPermute(perm);
+	primaryIndices.ParallelPermute(perm);
 
-	primaryIndices.SortPermutation(perm,false,true);	//Stable sort
-	secondaryIndices.Permute(perm);
-	primaryIndices.Permute(perm);
+	primaryIndices.ParallelSortPermutation(perm);	//Stable
+	secondaryIndices.ParallelPermute(perm);
+	primaryIndices.ParallelPermute(perm);
 
 	//Build the initial index array on primaryIndices
 	CHArray<argIntType,argIntType> iia;
@@ -289,10 +290,7 @@ template <class theType, class intType>
 void CAIStrings<theType,intType>::AddElement(const theType* pointer, intType numToCopy)
 {
 	//Store the element
-	for(intType i=0;i<numToCopy;i++)
-	{
-		storageArr.AddAndExtend(pointer[i]);
-	}
+	storageArr.Append(pointer,numToCopy);
 	initIndexArr.AddAndExtend(storageArr.GetNumPoints());
 }
 
@@ -301,14 +299,8 @@ template <class theType, class intType>
 template <class argIntType>
 void CAIStrings<theType,intType>::AddElement(const CHArray<theType,argIntType>& element)
 {
-	argIntType numToCopy=element.GetNumPoints();
-
 	//Store the element
-	for(argIntType i=0;i<numToCopy;i++)
-	{
-		storageArr.AddAndExtend(element.arr[i]);
-	}
-
+	storageArr.Append(element.arr,(intType)element.GetNumPoints());
 	initIndexArr.AddAndExtend(storageArr.GetNumPoints());
 }
 
@@ -319,10 +311,11 @@ void CAIStrings<theType,intType>::ImportElement(const CHArray<argType,argIntType
 {
 	argIntType numToCopy=element.GetNumPoints();
 
-	//Store the element
+	//Store the element, converting each point
+	storageArr.Reserve(storageArr.GetNumPoints()+(intType)numToCopy);
 	for(argIntType i=0;i<numToCopy;i++)
 	{
-		storageArr.AddAndExtend((theType)element.arr[i]);
+		storageArr.AddPoint((theType)element.arr[i]);
 	}
 
 	initIndexArr.AddAndExtend(storageArr.GetNumPoints());
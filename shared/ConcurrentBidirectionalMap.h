@@ -0,0 +1,261 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+
+#pragma once
+#include "BidirectionalMap.h"
+#include "boost/thread.hpp"
+#include <algorithm>
+
+//Type-to-int map for aggregating words from many threads at once
+//The words are split between shards by their hash, each shard is a CBidirectionalMap with its own mutex,
+//so threads only wait for each other when they add words that fall into the same shard
+
+//While words are being added, AddWordGetIndex() returns provisional ids: (index in the shard << shard bits) | shard
+//The ids are int64, so that a shard can hold as many words as a CBidirectionalMap
+//Freeze() is called once all threads are done: it puts all words into frozenMap in a deterministic order
+//(by value, or by frequency with ties broken by value), so the dense ids do not depend on thread timing
+//Provisional ids are converted with FrozenIndex(). Words are not added after Freeze(), until Clear()
+
+template <class theType> class CConcurrentBidirectionalMap
+{
+public:
+	enum FreezeOrder {orderByValue, orderByFrequency};
+
+public:
+	CConcurrentBidirectionalMap(int theNumShards=64, bool fFrequencies=true);		//The number of shards is rounded up to a power of two
+	~CConcurrentBidirectionalMap(void){delete[] shards;}
+
+private:
+	CConcurrentBidirectionalMap(const CConcurrentBidirectionalMap&);
+	CConcurrentBidirectionalMap& operator=(const CConcurrentBidirectionalMap&);
+
+public:
+	//Thread safe before Freeze()
+	int64 AddWordGetIndex(const theType& word, int numTimes=1);		//Returns the provisional id, -1 if frozen
+	bool AddWord(const theType& word, int numTimes=1);				//Returns true if the word was already there
+	void AddFromMap(CBidirectionalMap<theType>& otherMap);			//Adds all words with their frequencies, locking each shard once
+	int Count();
+
+	//Not thread safe
+	void Freeze(FreezeOrder order=orderByValue);
+	bool IsFrozen() const {return fFrozen;}
+	int FrozenIndex(int64 provisionalId) const;		//Dense id of a word from its provisional id, -1 if not frozen
+	void Clear();
+
+public:
+	CBidirectionalMap<theType> frozenMap;		//All words, with frequencies if counted, in the order of Freeze()
+
+private:
+	struct Shard
+	{
+		boost::mutex mutex;
+		CBidirectionalMap<theType> map;
+		CHArray<int> frozenIds;				//Dense ids of the shard's words, filled by Freeze()
+	};
+
+	int ShardOf(uint hash) const {return shardBits == 0 ? 0 : (int)(hash >> (32 - shardBits));}	//The shard maps probe with the low bits
+
+	Shard* shards;
+	int numShards;
+	int shardBits;
+	bool fFreq;
+	bool fFrozen;
+};
+
+template <class theType>
+CConcurrentBidirectionalMap<theType>::CConcurrentBidirectionalMap(int theNumShards, bool fFrequencies):
+frozenMap(-1,fFrequencies),
+shardBits(0),
+fFreq(fFrequencies),
+fFrozen(false)
+{
+	while((1 << shardBits) < theNumShards && shardBits < 16) shardBits++;
+	numShards = 1 << shardBits;
+
+	shards = new Shard[numShards];
+	for(int i=0; i < numShards; i++) shards[i].map.fFreq = fFreq;
+}
+
+template <class theType>
+int64 CConcurrentBidirectionalMap<theType>::AddWordGetIndex(const theType& word, int numTimes)
+{
+	if(fFrozen) return -1;
+
+	uint hash = CBidirectionalHash<theType>::Hash(word);
+	int shard = ShardOf(hash);
+
+	int index;
+	{
+		boost::mutex::scoped_lock lock(shards[shard].mutex);
+		index = shards[shard].map.AddWordWithHash(word, hash, numTimes);
+	}
+
+	return ((int64)index << shardBits) | shard;
+}
+
+template <class theType>
+bool CConcurrentBidirectionalMap<theType>::AddWord(const theType& word, int numTimes)
+{
+	if(fFrozen) return false;
+
+	uint hash = CBidirectionalHash<theType>::Hash(word);
+	Shard& shard = shards[ShardOf(hash)];
+
+	boost::mutex::scoped_lock lock(shard.mutex);
+	int prevCount = shard.map.Count();
+	shard.map.AddWordWithHash(word, hash, numTimes);
+	return shard.map.Count() == prevCount;
+}
+
+template <class theType>
+void CConcurrentBidirectionalMap<theType>::AddFromMap(CBidirectionalMap<theType>& otherMap)
+{
+	if(fFrozen) return;
+
+	//Group the words by shard first, reusing the other map's hashes if it has them
+	int numWords = otherMap.Count();
+	bool fHashes = (otherMap.GetBackend() == CBidirectionalMap<theType>::hashBackend);
+
+	CHArray<uint> hashes(numWords);
+	CHArray<int> shardCounts(numShards + 1, true);
+	for(int i=0; i <= numShards; i++) shardCounts[i] = 0;
+
+	for(int i=0; i < numWords; i++)
+	{
+		uint hash = fHashes ? otherMap.hashArr[i] : CBidirectionalHash<theType>::Hash(otherMap.wordArr[i]);
+		hashes.AddPoint(hash);
+		shardCounts[ShardOf(hash) + 1]++;
+	}
+
+	for(int i=0; i < numShards; i++) shardCounts[i+1] += shardCounts[i];
+
+	CHArray<int> order(numWords, true);
+	for(int i=0; i < numWords; i++) order[shardCounts[ShardOf(hashes[i])]++] = i;
+
+	//shardCounts[shard] is now the end of the shard's words in order
+	int begin = 0;
+	for(int shard=0; shard < numShards; shard++)
+	{
+		int end = shardCounts[shard];
+		if(end == begin) continue;
+
+		boost::mutex::scoped_lock lock(shards[shard].mutex);
+		for(int j=begin; j < end; j++)
+		{
+			int i = order[j];
+			int numTimes = otherMap.fFreq ? otherMap.freqArr[i] : 1;
+			shards[shard].map.AddWordWithHash(otherMap.wordArr[i], hashes[i], numTimes);
+		}
+
+		begin = end;
+	}
+}
+
+template <class theType>
+int CConcurrentBidirectionalMap<theType>::Count()
+{
+	if(fFrozen) return frozenMap.Count();
+
+	int count = 0;
+	for(int i=0; i < numShards; i++)
+	{
+		boost::mutex::scoped_lock lock(shards[i].mutex);
+		count += shards[i].map.Count();
+	}
+	return count;
+}
+
+template <class theType>
+void CConcurrentBidirectionalMap<theType>::Freeze(FreezeOrder order)
+{
+	if(fFrozen) return;
+
+	//Entries are (shard << 32) | index in the shard
+	int total = 0;
+	for(int i=0; i < numShards; i++) total += shards[i].map.Count();
+
+	CHArray<int64> entries(total);
+	for(int shard=0; shard < numShards; shard++)
+	{
+		for(int i=0; i < shards[shard].map.Count(); i++) entries.AddPoint(((int64)shard << 32) | i);
+	}
+
+	//The words are unique, so both orders are total and the result is deterministic
+	auto Word = [this](int64 entry)->const theType& {return shards[entry >> 32].map.wordArr[(int)(entry & 0xffffffff)];};
+	auto Freq = [this](int64 entry)->int {return shards[entry >> 32].map.freqArr[(int)(entry & 0xffffffff)];};
+
+	if(order == orderByFrequency && fFreq)
+	{
+		std::sort(entries.begin(), entries.end(), [&](int64 a, int64 b)->bool
+		{
+			int freqA = Freq(a), freqB = Freq(b);
+			if(freqA != freqB) return freqA > freqB;
+			return Word(a) < Word(b);
+		});
+	}
+	else std::sort(entries.begin(), entries.end(), [&](int64 a, int64 b)->bool {return Word(a) < Word(b);});
+
+	frozenMap.fFreq = fFreq;
+	frozenMap.Resize(total);
+
+	for(int shard=0; shard < numShards; shard++) shards[shard].frozenIds.ResizeArray(shards[shard].map.Count(), true);
+
+	for(int i=0; i < total; i++)
+	{
+		Shard& shard = shards[entries[i] >> 32];
+		int index = (int)(entries[i] & 0xffffffff);
+
+		int numTimes = fFreq ? shard.map.freqArr[index] : 1;
+		shard.frozenIds[index] = frozenMap.AddWordWithHash(shard.map.wordArr[index], shard.map.hashArr[index], numTimes);
+	}
+
+	//The words now live in frozenMap, the shard maps release their memory
+	for(int shard=0; shard < numShards; shard++) shards[shard].map = CBidirectionalMap<theType>(-1, fFreq);
+
+	fFrozen = true;
+}
+
+template <class theType>
+int CConcurrentBidirectionalMap<theType>::FrozenIndex(int64 provisionalId) const
+{
+	if(!fFrozen || provisionalId < 0) return -1;
+
+	Shard& shard = shards[provisionalId & (numShards - 1)];
+	int64 index = provisionalId >> shardBits;
+	if(index >= shard.frozenIds.Count()) return -1;
+
+	return shard.frozenIds[index];
+}
+
+template <class theType>
+void CConcurrentBidirectionalMap<theType>::Clear()
+{
+	for(int i=0; i < numShards; i++)
+	{
+		shards[i].map.Clear();
+		shards[i].frozenIds.Clear();
+	}
+
+	frozenMap.Clear();
+	fFrozen = false;
+}
@@ -24,6 +24,8 @@
 #include "SimpleXml.h"
 #include "Array.h"
 #include "Common.h"
+#include "HtmlEntities.h"
+#include "XmlTags.h"
 
 //Some regexes global to the namespace... Avoiding recompiling them on every use.
 RE2 DizzyUtility::wordRegex("(\\w+)");
@@ -341,7 +343,7 @@ BString DizzyUtility::URLforWikiPage(const BString& title)
 }
 
 //Extracts article text from parsed mediaWiki in XML
-//Replaces html entities and "strange dash"
+//Decodes html entities
 void DizzyUtility::WriteContentToString(xml_node& node, BString& string, bool fIncludeImCaptions/*=true*/)
 {
 	//Uses InternalWriteContent, a double-pass XML writer function
@@ -353,8 +355,7 @@ void DizzyUtility::WriteContentToString(xml_node& node, BString& string, bool fI
 	buffer[numSymbols]=0;
 	string=buffer.arr;
 
-	ConvertHtmlEntities(string);
-	ReplaceStrangeDash(string);
+	DecodeHtmlText(string);
 }
 
 //Extracts article text from parsed mediaWiki in XML
@@ -365,8 +366,8 @@ void DizzyUtility::InternalWriteContent(const xml_node& node, char* buffer, int&
 	//node_pcdata is printable
 	if(node.type()==node_pcdata)
 	{
-		BString value=node.value();
-		int length=value.GetLength();
+		const char* value=node.value();
+		int length=(int)strlen(value);
 		if(buffer!=NULL) memcpy(buffer+counter,value,length);
 		counter+=length;
 		return;
@@ -374,17 +375,17 @@ void DizzyUtility::InternalWriteContent(const xml_node& node, char* buffer, int&
 
 	//if it is not an element node at this point, it is not printable
 	if(node.type()!=node_element && node.type()!=node_document) return;
-	BString name=node.name();
+	XmlTag tag=XmlTags::GetTag(node);
 
 	//some element nodes are ignored completely
-	if(name=="template" || name=="interwiki" || name=="wTable" || name=="media" || name=="category") return;
-	if(name=="style" || name=="url") return;
+	if(tag==tagTemplate || tag==tagInterwiki || tag==tagWTable || tag==tagMedia || tag==tagCategory) return;
+	if(tag==tagStyle || tag==tagUrl) return;
 
 	//if it is a link, print the anchor text
-	if(name=="link" || name=="extLink") {InternalWriteContent(node.child("anchor"), buffer, counter, fIncludeImCaptions);return;}
+	if(tag==tagLink || tag==tagExtLink) {InternalWriteContent(node.child("anchor"), buffer, counter, fIncludeImCaptions);return;}
 
 	//if it is an image, print caption
-	if(name=="file")
+	if(tag==tagFile)
 	{
 		if(!fIncludeImCaptions) return;
 		InternalWriteContent(node.child("caption"),buffer,counter, fIncludeImCaptions);
@@ -401,7 +402,7 @@ void DizzyUtility::InternalWriteContent(const xml_node& node, char* buffer, int&
 	}
 
 	//If it was a par or a listEl, add a space at the end, unless the buffer is empty
-	if(name=="par" || name=="listEl" || name=="title" || name=="secTitle")
+	if(tag==tagPar || tag==tagListEl || tag==tagTitle || tag==tagSecTitle)
 	{
 		if(counter!=0) InsertIntoWriteBuffer(' ', buffer, counter);
 	}
@@ -414,33 +415,176 @@ void DizzyUtility::InsertIntoWriteBuffer(char symbol, char* buffer, int& counter
 	counter++;
 }
 
-//converts some frequent html entities
-void DizzyUtility::ConvertHtmlEntities(BString& text)
-{
-	RemoveAmp(text);
-	text.Replace("&gt;",">");
-	text.Replace("&lt;","<");
-
-	text.Replace("&nbsp;"," ");
-	text.Replace("&quot;","\"");
-	text.Replace("&mdash;"," - ");
-	text.Replace("&ndash;"," - ");
-}
-
 //Replaces &amp; with & once
 void DizzyUtility::RemoveAmpOnce(BString& string)
 {
 	string.Replace("&amp;","&");
 }
 
-//Replaces &amp; with & as many times as necessary
-void DizzyUtility::RemoveAmp(BString& text)
+namespace
 {
-	while(text.Find("&amp;")!=-1) text.Replace("&amp;","&");
+	//Output helper for DecodeHtmlText() - appends a symbol, applying the tab and LF rules if maxLFRun > 0
+	//numLF is the number of LFs at the end of the output
+	inline void AppendDecoded(BString& result, char symbol, int maxLFRun, int& numLF)
+	{
+		if(maxLFRun > 0)
+		{
+			if(symbol != '\n') numLF = 0;
+			else
+			{
+				//A tab before the LF is dropped, which can join this LF to the run before the tab
+				if(!result.empty() && result.back() == '\t')
+				{
+					result.pop_back();
+					numLF = 0;
+					for(size_t i = result.size(); i > 0 && result[i-1] == '\n' && numLF < maxLFRun; i--) numLF++;
+				}
+
+				if(numLF >= maxLFRun) return;
+				numLF++;
+			}
+		}
+
+		result += symbol;
+	}
+
+	inline void AppendDecoded(BString& result, const char* string, int maxLFRun, int& numLF)
+	{
+		for(; *string != 0; string++) AppendDecoded(result, *string, maxLFRun, numLF);
+	}
+
+	//Code points for references to 0x80...0x9F, which are read as windows-1252 as in HTML5, 0 - not remapped
+	const int windows1252[32] = {
+		0x20AC, 0, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0, 0x017D, 0,
+		0, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0, 0x017E, 0x0178};
+
+	//Parses a numeric entity body, "#160" or "#xA0", between begin and the semicolon at end
+	//Returns the code point to output, or -1 if the body is not a number
+	//As in HTML5, references to 0, surrogates and values above 0x10FFFF give U+FFFD, and so do the controls
+	//that cannot be in the output - C0 other than tab, LF and CR, DEL, and C1 that windows-1252 does not remap
+	int ParseNumericEntity(const char* begin, const char* end)
+	{
+		const char* cur = begin + 1;
+		bool fHex = (cur < end && (*cur == 'x' || *cur == 'X'));
+		if(fHex) cur++;
+		if(cur == end) return -1;
+
+		int code = 0;
+		for(; cur < end; cur++)
+		{
+			int digit;
+			if(*cur >= '0' && *cur <= '9') digit = *cur - '0';
+			else if(fHex && *cur >= 'a' && *cur <= 'f') digit = *cur - 'a' + 10;
+			else if(fHex && *cur >= 'A' && *cur <= 'F') digit = *cur - 'A' + 10;
+			else return -1;
+
+			if(code <= 0x10FFFF) code = code*(fHex ? 16 : 10) + digit;		//Stops growing once out of range
+		}
+
+		if(code >= 0x80 && code <= 0x9F && windows1252[code - 0x80] != 0) return windows1252[code - 0x80];
+
+		if(code == 0 || code > 0x10FFFF || (code >= 0xD800 && code <= 0xDFFF)) return 0xFFFD;
+		if(code < 0x20 && code != 0x09 && code != 0x0A && code != 0x0D) return 0xFFFD;
+		if(code >= 0x7F && code <= 0x9F) return 0xFFFD;
+		return code;
+	}
+
+	//Writes a code point as UTF-8 into buffer, which must hold 5 symbols
+	void CodePointToUtf8(int code, char* buffer)
+	{
+		if(code < 0x80) {buffer[0] = (char)code; buffer[1] = 0;}
+		else if(code < 0x800)
+		{
+			buffer[0] = (char)(0xC0 | (code >> 6));
+			buffer[1] = (char)(0x80 | (code & 0x3F));
+			buffer[2] = 0;
+		}
+		else if(code < 0x10000)
+		{
+			buffer[0] = (char)(0xE0 | (code >> 12));
+			buffer[1] = (char)(0x80 | ((code >> 6) & 0x3F));
+			buffer[2] = (char)(0x80 | (code & 0x3F));
+			buffer[3] = 0;
+		}
+		else
+		{
+			buffer[0] = (char)(0xF0 | (code >> 18));
+			buffer[1] = (char)(0x80 | ((code >> 12) & 0x3F));
+			buffer[2] = (char)(0x80 | ((code >> 6) & 0x3F));
+			buffer[3] = (char)(0x80 | (code & 0x3F));
+			buffer[4] = 0;
+		}
+	}
+
+	inline bool IsEntityNameSymbol(char symbol)
+	{
+		return (symbol >= 'a' && symbol <= 'z') || (symbol >= 'A' && symbol <= 'Z') || (symbol >= '0' && symbol <= '9');
+	}
 }
 
-//Replaces strange dash
-void DizzyUtility::ReplaceStrangeDash(BString& string)
+//Decodes html entities in the text for output, in a single pass
+void DizzyUtility::DecodeHtmlText(BString& text, int maxLFRun/*=0*/)
 {
-	string.Replace("\xE2\x80\x93","-");
+	const char* cur = text.c_str();
+	const char* end = cur + text.size();
+
+	BString result;
+	result.reserve(text.size());
+	int numLF = 0;
+	char utf8[5];
+
+	while(cur < end)
+	{
+		//Strange dash
+		if(*cur == '\xE2' && end-cur >= 3 && cur[1] == '\x80' && cur[2] == '\x93')
+		{
+			AppendDecoded(result, '-', maxLFRun, numLF);
+			cur += 3;
+			continue;
+		}
+
+		if(*cur != '&')
+		{
+			AppendDecoded(result, *cur, maxLFRun, numLF);
+			cur++;
+			continue;
+		}
+
+		//&amp;amp;... is a single ampersand, which may start an entity
+		const char* name = cur + 1;
+		while(end-name >= 4 && memcmp(name, "amp;", 4) == 0) name += 4;
+
+		const char* nameEnd = name;
+		if(nameEnd < end && *nameEnd == '#') nameEnd++;
+		while(nameEnd < end && nameEnd-name <= HtmlEntities::maxNameLength && IsEntityNameSymbol(*nameEnd)) nameEnd++;
+
+		const char* value = NULL;
+		if(nameEnd < end && *nameEnd == ';' && nameEnd > name)
+		{
+			int length = (int)(nameEnd-name);
+
+			if(*name == '#')
+			{
+				int code = ParseNumericEntity(name, nameEnd);
+				if(code == 0x2013) value = "-";
+				else if(code != -1) {CodePointToUtf8(code, utf8); value = utf8;}
+			}
+			else if(length == 4 && memcmp(name, "nbsp", 4) == 0) value = " ";
+			else if(length == 5 && (memcmp(name, "mdash", 5) == 0 || memcmp(name, "ndash", 5) == 0)) value = " - ";
+			else value = HtmlEntities::Lookup(name, length);
+		}
+
+		if(value != NULL)
+		{
+			AppendDecoded(result, value, maxLFRun, numLF);
+			cur = nameEnd + 1;
+		}
+		else
+		{
+			AppendDecoded(result, '&', maxLFRun, numLF);
+			cur = name;
+		}
+	}
+
+	text.swap(result);
 }
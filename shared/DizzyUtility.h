@@ -107,12 +107,13 @@ namespace DizzyUtility
     void InternalWriteContent(const pugi::xml_node &node, char* buffer, int& counter, bool fIncludeImCaptions=true);
 	void InsertIntoWriteBuffer(char symbol, char* buffer, int& counter);	//Internal helper for content writer
 
-	//converts some frequent html entities
-	void ConvertHtmlEntities(BString& text);
+	//Decodes html entities in the text for output, in a single pass
+	//Named (HTML5 table) and numeric entities; nested &amp;amp;... is unwrapped to & first
+	//&nbsp; becomes a space, &mdash; and &ndash; become " - ", the "strange dash" U+2013 becomes "-"
+	//If maxLFRun > 0, also removes a tab before each LF and limits runs of LFs to maxLFRun
+	void DecodeHtmlText(BString& text, int maxLFRun=0);
 
 	void RemoveAmpOnce(BString& string);	//Replaces &amp; with & once
-	void RemoveAmp(BString& text);			//Replaces &amp; with & as many times as necessary
-	void ReplaceStrangeDash(BString& string);
 
 	//Regexes global to the namespace - not ideal, but allows to avoid recompiling them on every call
 	extern RE2 wordRegex;	// Is simply "(\\w+)"
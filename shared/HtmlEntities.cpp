@@ -0,0 +1,4234 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+//Generated from the HTML5 named character reference table (https://html.spec.whatwg.org/entities.json)
+//Only the names terminated with a semicolon are included
+//The table is a perfect hash: a name hashes to a bucket, the bucket displacement gives its only possible slot
+
+#include "HtmlEntities.h"
+#include <string.h>
+
+namespace
+{
+	struct HtmlEntity
+	{
+		const char* name;
+		const char* value;		//UTF-8
+	};
+
+	const int numBuckets = 1024;
+	const int numSlots = 4096;
+
+	//FNV-1a, seeded
+	inline unsigned int EntityHash(const char* name, int length, unsigned int seed)
+	{
+		unsigned int hash = 2166136261u ^ seed;
+		for(int i=0; i < length; i++)
+		{
+			hash ^= (unsigned char)name[i];
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
+	const unsigned short displacements[numBuckets] =
+	{
+		2, 1, 3, 1, 1, 1, 2, 1, 1, 2, 1, 4, 1, 1, 0, 2,
+		3, 1, 1, 2, 4, 1, 2, 1, 2, 5, 0, 1, 1, 1, 1, 1,
+		1, 1, 1, 3, 1, 2, 2, 3, 1, 1, 1, 2, 2, 2, 1, 1,
+		1, 3, 3, 2, 1, 1, 20, 2, 1, 1, 1, 3, 1, 4, 1, 2,
+		2, 2, 0, 1, 1, 2, 6, 1, 6, 1, 2, 2, 1, 2, 0, 7,
+		1, 2, 0, 4, 1, 1, 1, 1, 1, 1, 0, 2, 1, 5, 1, 1,
+		4, 1, 0, 2, 1, 1, 1, 1, 1, 2, 1, 1, 3, 2, 0, 2,
+		1, 0, 4, 3, 0, 1, 0, 1, 1, 1, 0, 1, 2, 1, 1, 5,
+		1, 6, 2, 1, 1, 1, 1, 3, 1, 3, 1, 1, 1, 1, 1, 2,
+		11, 1, 1, 1, 4, 1, 2, 2, 6, 0, 1, 1, 2, 1, 4, 1,
+		2, 1, 1, 1, 3, 9, 2, 1, 4, 1, 2, 1, 6, 3, 1, 0,
+		5, 3, 2, 4, 0, 3, 1, 1, 2, 3, 1, 13, 1, 1, 1, 1,
+		1, 3, 1, 64, 1, 1, 0, 1, 1, 0, 2, 3, 1, 0, 10, 3,
+		1, 1, 2, 2, 0, 3, 1, 1, 0, 1, 0, 2, 2, 2, 1, 1,
+		1, 1, 4, 1, 5, 6, 1, 1, 3, 0, 4, 1, 4, 1, 66, 2,
+		2, 2, 1, 1, 1, 3, 0, 2, 2, 2, 2, 15, 5, 1, 0, 1,
+		4, 4, 2, 1, 4, 1, 1, 1, 6, 1, 2, 2, 2, 3, 9, 4,
+		1, 64, 2, 1, 64, 3, 1, 1, 0, 22, 4, 0, 1, 4, 3, 8,
+		1, 2, 1, 1, 0, 2, 1, 3, 2, 2, 3, 1, 3, 5, 0, 4,
+		1, 2, 1, 3, 0, 1, 1, 1, 2, 1, 1, 1, 1, 14, 0, 3,
+		0, 1, 5, 2, 1, 1, 1, 1, 1, 30, 1, 1, 19, 1, 1, 27,
+		1, 1, 2, 1, 1, 2, 4, 3, 65, 5, 1, 3, 2, 40, 1, 1,
+		3, 1, 2, 0, 0, 3, 0, 0, 3, 64, 0, 1, 3, 1, 1, 1,
+		2, 2, 0, 6, 3, 2, 4, 2, 3, 1, 2, 0, 12, 1, 0, 0,
+		5, 4, 2, 17, 1, 1, 1, 1, 3, 3, 1, 1, 0, 1, 1, 1,
+		24, 1, 5, 5, 1, 2, 2, 1, 1, 66, 6, 3, 0, 0, 1, 0,
+		0, 1, 2, 1, 0, 4, 1, 2, 64, 1, 1, 2, 1, 3, 1, 2,
+		1, 2, 0, 1, 6, 5, 2, 1, 1, 3, 65, 1, 1, 2, 1, 7,
+		2, 2, 1, 0, 1, 1, 0, 7, 1, 1, 21, 1, 1, 0, 1, 1,
+		1, 13, 1, 30, 1, 0, 0, 1, 2, 2, 1, 0, 3, 1, 1, 2,
+		0, 0, 1, 2, 7, 3, 3, 1, 2, 1, 4, 1, 3, 0, 0, 1,
+		1, 1, 0, 1, 1, 1, 1, 3, 14, 7, 1, 0, 0, 0, 5, 2,
+		3, 0, 2, 4, 5, 3, 1, 1, 12, 1, 2, 6, 1, 2, 4, 1,
+		1, 0, 3, 4, 1, 1, 2, 1, 15, 1, 1, 1, 2, 0, 0, 1,
+		7, 19, 1, 2, 3, 8, 1, 7, 18, 1, 1, 1, 0, 3, 3, 1,
+		0, 2, 6, 2, 6, 1, 5, 1, 1, 1, 1, 1, 1, 3, 0, 2,
+		68, 2, 1, 2, 1, 1, 1, 0, 2, 2, 0, 1, 21, 0, 2, 1,
+		1, 1, 2, 9, 0, 0, 1, 2, 1, 1, 4, 3, 7, 0, 2, 1,
+		3, 6, 3, 4, 6, 1, 2, 2, 1, 2, 2, 1, 3, 71, 0, 0,
+		1, 0, 2, 1, 4, 5, 5, 1, 3, 2, 1, 0, 2, 0, 22, 13,
+		1, 1, 2, 26, 17, 1, 1, 3, 3, 2, 0, 13, 3, 1, 0, 1,
+		1, 2, 2, 2, 1, 10, 65, 1, 2, 4, 1, 1, 1, 0, 2, 2,
+		2, 0, 1, 2, 3, 62, 9, 4, 1, 1, 1, 2, 3, 0, 2, 1,
+		2, 2, 1, 1, 1, 1, 1, 5, 3, 20, 7, 1, 0, 0, 2, 2,
+		3, 1, 1, 1, 1, 0, 2, 1, 1, 1, 2, 0, 6, 42, 3, 1,
+		8, 2, 1, 0, 9, 1, 1, 1, 2, 0, 1, 1, 3, 0, 4, 15,
+		0, 5, 2, 8, 0, 0, 6, 1, 1, 64, 1, 4, 6, 2, 1, 3,
+		65, 2, 64, 1, 7, 1, 4, 1, 1, 5, 13, 2, 1, 0, 1, 0,
+		1, 0, 1, 4, 4, 0, 1, 5, 1, 5, 1, 9, 12, 2, 6, 2,
+		65, 1, 2, 1, 15, 1, 1, 2, 7, 5, 18, 1, 1, 1, 68, 3,
+		5, 0, 1, 1, 1, 20, 1, 3, 4, 1, 1, 11, 1, 2, 1, 2,
+		1, 1, 3, 1, 4, 0, 1, 65, 0, 4, 22, 3, 3, 68, 2, 2,
+		6, 12, 1, 1, 9, 1, 7, 3, 1, 20, 4, 4, 10, 64, 9, 1,
+		1, 0, 0, 4, 2, 2, 0, 7, 1, 1, 7, 3, 5, 1, 2, 2,
+		2, 0, 4, 70, 0, 0, 2, 1, 14, 8, 2, 1, 2, 4, 2, 1,
+		2, 1, 3, 1, 2, 2, 27, 1, 1, 1, 3, 1, 6, 2, 35, 2,
+		0, 0, 3, 1, 0, 2, 1, 2, 1, 1, 1, 64, 1, 1, 64, 2,
+		2, 1, 3, 0, 4, 8, 10, 0, 5, 65, 2, 0, 15, 20, 2, 1,
+		7, 9, 2, 4, 1, 7, 5, 16, 6, 4, 18, 1, 2, 1, 11, 1,
+		1, 3, 2, 1, 2, 2, 21, 1, 2, 0, 9, 1, 1, 1, 1, 0,
+		2, 0, 1, 1, 0, 0, 2, 65, 1, 1, 1, 0, 5, 4, 1, 0,
+		4, 2, 1, 4, 3, 0, 5, 1, 3, 3, 3, 21, 7, 9, 4, 3,
+		0, 2, 29, 42, 15, 3, 1, 2, 1, 2, 1, 1, 1, 12, 3, 3,
+		0, 1, 1, 64, 1, 4, 3, 0, 2, 0, 1, 1, 6, 0, 1, 2
+	};
+
+	const HtmlEntity slots[numSlots] =
+	{
+		{NULL, NULL},
+		{"oopf", "\360\235\225\240"},
+		{"lowast", "\342\210\227"},
+		{"UpArrowBar", "\342\244\222"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"uwangle", "\342\246\247"},
+		{NULL, NULL},
+		{"longrightarrow", "\342\237\266"},
+		{NULL, NULL},
+		{"nLl", "\342\213\230\314\270"},
+		{NULL, NULL},
+		{"Equal", "\342\251\265"},
+		{NULL, NULL},
+		{"frac12", "\302\275"},
+		{"gne", "\342\252\210"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"period", "\056"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ring", "\313\232"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"thksim", "\342\210\274"},
+		{NULL, NULL},
+		{"uogon", "\305\263"},
+		{"bigcirc", "\342\227\257"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"circleddash", "\342\212\235"},
+		{"Copf", "\342\204\202"},
+		{NULL, NULL},
+		{"copf", "\360\235\225\224"},
+		{NULL, NULL},
+		{"LJcy", "\320\211"},
+		{NULL, NULL},
+		{"ecir", "\342\211\226"},
+		{"Because", "\342\210\265"},
+		{NULL, NULL},
+		{"Delta", "\316\224"},
+		{"dArr", "\342\207\223"},
+		{"sqsubseteq", "\342\212\221"},
+		{"Bscr", "\342\204\254"},
+		{"ell", "\342\204\223"},
+		{"ldsh", "\342\206\262"},
+		{"xotime", "\342\250\202"},
+		{"boxh", "\342\224\200"},
+		{"ReverseEquilibrium", "\342\207\213"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"triplus", "\342\250\271"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"aogon", "\304\205"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"loplus", "\342\250\255"},
+		{NULL, NULL},
+		{"scy", "\321\201"},
+		{"raquo", "\302\273"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"cuwed", "\342\213\217"},
+		{"rmoust", "\342\216\261"},
+		{"Uparrow", "\342\207\221"},
+		{"prime", "\342\200\262"},
+		{"NotSucceeds", "\342\212\201"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nsup", "\342\212\205"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"bbrk", "\342\216\265"},
+		{NULL, NULL},
+		{"lstrok", "\305\202"},
+		{NULL, NULL},
+		{"Vcy", "\320\222"},
+		{"real", "\342\204\234"},
+		{"OElig", "\305\222"},
+		{"sbquo", "\342\200\232"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lcy", "\320\273"},
+		{"IOcy", "\320\201"},
+		{"nvHarr", "\342\244\204"},
+		{NULL, NULL},
+		{"YIcy", "\320\207"},
+		{NULL, NULL},
+		{"bumpe", "\342\211\217"},
+		{"Nopf", "\342\204\225"},
+		{"larrb", "\342\207\244"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"searhk", "\342\244\245"},
+		{"leftrightarrows", "\342\207\206"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"bigtriangledown", "\342\226\275"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"harrw", "\342\206\255"},
+		{"gbreve", "\304\237"},
+		{"dot", "\313\231"},
+		{NULL, NULL},
+		{"Odblac", "\305\220"},
+		{"uharr", "\342\206\276"},
+		{"capdot", "\342\251\200"},
+		{"cross", "\342\234\227"},
+		{"Superset", "\342\212\203"},
+		{"simne", "\342\211\206"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"NotExists", "\342\210\204"},
+		{"Gdot", "\304\240"},
+		{"afr", "\360\235\224\236"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"opar", "\342\246\267"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lcaron", "\304\276"},
+		{"lg", "\342\211\266"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"sce", "\342\252\260"},
+		{"darr", "\342\206\223"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"eth", "\303\260"},
+		{NULL, NULL},
+		{"larrlp", "\342\206\253"},
+		{"dlcrop", "\342\214\215"},
+		{"LongLeftRightArrow", "\342\237\267"},
+		{"Psi", "\316\250"},
+		{"ufr", "\360\235\224\262"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"DoubleRightTee", "\342\212\250"},
+		{NULL, NULL},
+		{"lE", "\342\211\246"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rdca", "\342\244\267"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Uscr", "\360\235\222\260"},
+		{"odiv", "\342\250\270"},
+		{NULL, NULL},
+		{"mcy", "\320\274"},
+		{"Lcaron", "\304\275"},
+		{"frac78", "\342\205\236"},
+		{"supplus", "\342\253\200"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"csub", "\342\253\217"},
+		{NULL, NULL},
+		{"isinE", "\342\213\271"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Sacute", "\305\232"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nbump", "\342\211\216\314\270"},
+		{"dcy", "\320\264"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"target", "\342\214\226"},
+		{NULL, NULL},
+		{"leftarrowtail", "\342\206\242"},
+		{NULL, NULL},
+		{"nvinfin", "\342\247\236"},
+		{NULL, NULL},
+		{"Succeeds", "\342\211\273"},
+		{NULL, NULL},
+		{"lfloor", "\342\214\212"},
+		{"PrecedesTilde", "\342\211\276"},
+		{"complexes", "\342\204\202"},
+		{NULL, NULL},
+		{"blacktriangleleft", "\342\227\202"},
+		{"circ", "\313\206"},
+		{NULL, NULL},
+		{"DoubleLeftArrow", "\342\207\220"},
+		{NULL, NULL},
+		{"npart", "\342\210\202\314\270"},
+		{NULL, NULL},
+		{"order", "\342\204\264"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Longleftarrow", "\342\237\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Egrave", "\303\210"},
+		{"succeq", "\342\252\260"},
+		{"hbar", "\342\204\217"},
+		{"udhar", "\342\245\256"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"tscr", "\360\235\223\211"},
+		{NULL, NULL},
+		{"VeryThinSpace", "\342\200\212"},
+		{NULL, NULL},
+		{"Aogon", "\304\204"},
+		{"TScy", "\320\246"},
+		{NULL, NULL},
+		{"infin", "\342\210\236"},
+		{"lharu", "\342\206\274"},
+		{NULL, NULL},
+		{"Sc", "\342\252\274"},
+		{"thinsp", "\342\200\211"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"fscr", "\360\235\222\273"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"emptyset", "\342\210\205"},
+		{"tridot", "\342\227\254"},
+		{"nGg", "\342\213\231\314\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"HilbertSpace", "\342\204\213"},
+		{"tosa", "\342\244\251"},
+		{NULL, NULL},
+		{"phi", "\317\206"},
+		{NULL, NULL},
+		{"rarrb", "\342\207\245"},
+		{NULL, NULL},
+		{"NotGreaterGreater", "\342\211\253\314\270"},
+		{"Gt", "\342\211\253"},
+		{"yacute", "\303\275"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"DiacriticalGrave", "\140"},
+		{"bot", "\342\212\245"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"dwangle", "\342\246\246"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"xfr", "\360\235\224\265"},
+		{"NewLine", "\012"},
+		{"nGtv", "\342\211\253\314\270"},
+		{NULL, NULL},
+		{"equest", "\342\211\237"},
+		{"KHcy", "\320\245"},
+		{NULL, NULL},
+		{"beta", "\316\262"},
+		{"EmptyVerySmallSquare", "\342\226\253"},
+		{NULL, NULL},
+		{"Lcy", "\320\233"},
+		{"xmap", "\342\237\274"},
+		{"Ucy", "\320\243"},
+		{NULL, NULL},
+		{"nopf", "\360\235\225\237"},
+		{NULL, NULL},
+		{"lbrksld", "\342\246\217"},
+		{NULL, NULL},
+		{"ne", "\342\211\240"},
+		{"backprime", "\342\200\265"},
+		{"GreaterTilde", "\342\211\263"},
+		{"complement", "\342\210\201"},
+		{"natural", "\342\231\256"},
+		{NULL, NULL},
+		{"xi", "\316\276"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"vsupnE", "\342\253\214\357\270\200"},
+		{"topbot", "\342\214\266"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"iinfin", "\342\247\234"},
+		{"curvearrowright", "\342\206\267"},
+		{"becaus", "\342\210\265"},
+		{NULL, NULL},
+		{"Exists", "\342\210\203"},
+		{"boxvh", "\342\224\274"},
+		{"ntrianglerighteq", "\342\213\255"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rbrke", "\342\246\214"},
+		{"andd", "\342\251\234"},
+		{NULL, NULL},
+		{"pound", "\302\243"},
+		{"NotEqual", "\342\211\240"},
+		{NULL, NULL},
+		{"boxuL", "\342\225\233"},
+		{"pluscir", "\342\250\242"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"osol", "\342\212\230"},
+		{"Ocirc", "\303\224"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"subset", "\342\212\202"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"SHcy", "\320\250"},
+		{"zwj", "\342\200\215"},
+		{"Gscr", "\360\235\222\242"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"wfr", "\360\235\224\264"},
+		{NULL, NULL},
+		{"nprec", "\342\212\200"},
+		{"rdquor", "\342\200\235"},
+		{"ffilig", "\357\254\203"},
+		{NULL, NULL},
+		{"lArr", "\342\207\220"},
+		{"integers", "\342\204\244"},
+		{NULL, NULL},
+		{"backsim", "\342\210\275"},
+		{"easter", "\342\251\256"},
+		{"twixt", "\342\211\254"},
+		{"ThickSpace", "\342\201\237\342\200\212"},
+		{"bsolhsub", "\342\237\210"},
+		{NULL, NULL},
+		{"gdot", "\304\241"},
+		{"sqsupseteq", "\342\212\222"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"LongRightArrow", "\342\237\266"},
+		{"dblac", "\313\235"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"hopf", "\360\235\225\231"},
+		{"fork", "\342\213\224"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rAarr", "\342\207\233"},
+		{NULL, NULL},
+		{"lap", "\342\252\205"},
+		{"lrtri", "\342\212\277"},
+		{"yen", "\302\245"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"drbkarow", "\342\244\220"},
+		{NULL, NULL},
+		{"lesseqqgtr", "\342\252\213"},
+		{NULL, NULL},
+		{"boxUR", "\342\225\232"},
+		{"gfr", "\360\235\224\244"},
+		{"njcy", "\321\232"},
+		{"IEcy", "\320\225"},
+		{NULL, NULL},
+		{"subsub", "\342\253\225"},
+		{NULL, NULL},
+		{"UpperRightArrow", "\342\206\227"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Hscr", "\342\204\213"},
+		{"larrsim", "\342\245\263"},
+		{"varrho", "\317\261"},
+		{NULL, NULL},
+		{"dbkarow", "\342\244\217"},
+		{"nsube", "\342\212\210"},
+		{"ap", "\342\211\210"},
+		{NULL, NULL},
+		{"CloseCurlyQuote", "\342\200\231"},
+		{NULL, NULL},
+		{"LeftDownTeeVector", "\342\245\241"},
+		{"xvee", "\342\213\201"},
+		{NULL, NULL},
+		{"ltquest", "\342\251\273"},
+		{"lscr", "\360\235\223\201"},
+		{"Union", "\342\213\203"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ntlg", "\342\211\270"},
+		{"pre", "\342\252\257"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"circledcirc", "\342\212\232"},
+		{NULL, NULL},
+		{"quot", "\042"},
+		{NULL, NULL},
+		{"notin", "\342\210\211"},
+		{"Lopf", "\360\235\225\203"},
+		{NULL, NULL},
+		{"RightVectorBar", "\342\245\223"},
+		{"hairsp", "\342\200\212"},
+		{"PlusMinus", "\302\261"},
+		{NULL, NULL},
+		{"vopf", "\360\235\225\247"},
+		{"bnot", "\342\214\220"},
+		{"lrhard", "\342\245\255"},
+		{"precsim", "\342\211\276"},
+		{"seArr", "\342\207\230"},
+		{"TripleDot", "\342\203\233"},
+		{"eogon", "\304\231"},
+		{NULL, NULL},
+		{"DDotrahd", "\342\244\221"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"hellip", "\342\200\246"},
+		{"ucirc", "\303\273"},
+		{"Emacr", "\304\222"},
+		{"ratail", "\342\244\232"},
+		{NULL, NULL},
+		{"boxhu", "\342\224\264"},
+		{NULL, NULL},
+		{"rdsh", "\342\206\263"},
+		{"ohm", "\316\251"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nsupE", "\342\253\206\314\270"},
+		{NULL, NULL},
+		{"gtrapprox", "\342\252\206"},
+		{"heartsuit", "\342\231\245"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lAtail", "\342\244\233"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"marker", "\342\226\256"},
+		{"RightFloor", "\342\214\213"},
+		{NULL, NULL},
+		{"semi", "\073"},
+		{NULL, NULL},
+		{"ncy", "\320\275"},
+		{"nsucc", "\342\212\201"},
+		{"Not", "\342\253\254"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"alpha", "\316\261"},
+		{NULL, NULL},
+		{"bcong", "\342\211\214"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"hookrightarrow", "\342\206\252"},
+		{NULL, NULL},
+		{"there4", "\342\210\264"},
+		{"OpenCurlyQuote", "\342\200\230"},
+		{NULL, NULL},
+		{"Fouriertrf", "\342\204\261"},
+		{NULL, NULL},
+		{"bbrktbrk", "\342\216\266"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ecy", "\321\215"},
+		{NULL, NULL},
+		{"angmsdah", "\342\246\257"},
+		{"verbar", "\174"},
+		{"timesd", "\342\250\260"},
+		{"sup", "\342\212\203"},
+		{NULL, NULL},
+		{"LowerRightArrow", "\342\206\230"},
+		{NULL, NULL},
+		{"nrarrc", "\342\244\263\314\270"},
+		{"Rfr", "\342\204\234"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rarrhk", "\342\206\252"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"midcir", "\342\253\260"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ordm", "\302\272"},
+		{NULL, NULL},
+		{"CircleDot", "\342\212\231"},
+		{"rarrtl", "\342\206\243"},
+		{NULL, NULL},
+		{"ropar", "\342\246\206"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Zacute", "\305\271"},
+		{"NotLessTilde", "\342\211\264"},
+		{"ShortUpArrow", "\342\206\221"},
+		{"nrtrie", "\342\213\255"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"doteqdot", "\342\211\221"},
+		{NULL, NULL},
+		{"duarr", "\342\207\265"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"amp", "\046"},
+		{"SquareSupersetEqual", "\342\212\222"},
+		{NULL, NULL},
+		{"lesdoto", "\342\252\201"},
+		{"Epsilon", "\316\225"},
+		{"rcedil", "\305\227"},
+		{"ltlarr", "\342\245\266"},
+		{"leftrightsquigarrow", "\342\206\255"},
+		{"ngE", "\342\211\247\314\270"},
+		{"reg", "\302\256"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Conint", "\342\210\257"},
+		{"UpTeeArrow", "\342\206\245"},
+		{NULL, NULL},
+		{"NotNestedGreaterGreater", "\342\252\242\314\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"xsqcup", "\342\250\206"},
+		{"circlearrowright", "\342\206\273"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"radic", "\342\210\232"},
+		{NULL, NULL},
+		{"NegativeVeryThinSpace", "\342\200\213"},
+		{NULL, NULL},
+		{"smtes", "\342\252\254\357\270\200"},
+		{"nexist", "\342\210\204"},
+		{"bnequiv", "\342\211\241\342\203\245"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rrarr", "\342\207\211"},
+		{NULL, NULL},
+		{"RightTriangle", "\342\212\263"},
+		{"Proportion", "\342\210\267"},
+		{"rightharpoonup", "\342\207\200"},
+		{NULL, NULL},
+		{"ntriangleright", "\342\213\253"},
+		{"ddagger", "\342\200\241"},
+		{NULL, NULL},
+		{"squarf", "\342\226\252"},
+		{"dfr", "\360\235\224\241"},
+		{NULL, NULL},
+		{"Jfr", "\360\235\224\215"},
+		{"nearhk", "\342\244\244"},
+		{"maltese", "\342\234\240"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"tdot", "\342\203\233"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"uHar", "\342\245\243"},
+		{"DownArrowUpArrow", "\342\207\265"},
+		{"DifferentialD", "\342\205\206"},
+		{"bNot", "\342\253\255"},
+		{"zwnj", "\342\200\214"},
+		{NULL, NULL},
+		{"RightTeeArrow", "\342\206\246"},
+		{"agrave", "\303\240"},
+		{"NotSquareSubsetEqual", "\342\213\242"},
+		{"sqcap", "\342\212\223"},
+		{"SquareSuperset", "\342\212\220"},
+		{NULL, NULL},
+		{"ordf", "\302\252"},
+		{"Ccirc", "\304\210"},
+		{"nspar", "\342\210\246"},
+		{"piv", "\317\226"},
+		{"submult", "\342\253\201"},
+		{"hslash", "\342\204\217"},
+		{"glE", "\342\252\222"},
+		{"Gopf", "\360\235\224\276"},
+		{"lthree", "\342\213\213"},
+		{"triangleleft", "\342\227\203"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lagran", "\342\204\222"},
+		{"triminus", "\342\250\272"},
+		{NULL, NULL},
+		{"yscr", "\360\235\223\216"},
+		{NULL, NULL},
+		{"fpartint", "\342\250\215"},
+		{"ang", "\342\210\240"},
+		{"supnE", "\342\253\214"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"NonBreakingSpace", "\302\240"},
+		{NULL, NULL},
+		{"boxH", "\342\225\220"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"awconint", "\342\210\263"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"urtri", "\342\227\271"},
+		{NULL, NULL},
+		{"swArr", "\342\207\231"},
+		{"Iacute", "\303\215"},
+		{"cupbrcap", "\342\251\210"},
+		{"Ycirc", "\305\266"},
+		{NULL, NULL},
+		{"nrArr", "\342\207\217"},
+		{"nesim", "\342\211\202\314\270"},
+		{"sqsupe", "\342\212\222"},
+		{NULL, NULL},
+		{"Dopf", "\360\235\224\273"},
+		{NULL, NULL},
+		{"NotHumpDownHump", "\342\211\216\314\270"},
+		{"DotDot", "\342\203\234"},
+		{NULL, NULL},
+		{"abreve", "\304\203"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lvnE", "\342\211\250\357\270\200"},
+		{"xodot", "\342\250\200"},
+		{"aacute", "\303\241"},
+		{"leqslant", "\342\251\275"},
+		{"isinv", "\342\210\210"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ssetmn", "\342\210\226"},
+		{"Ascr", "\360\235\222\234"},
+		{"Nu", "\316\235"},
+		{"origof", "\342\212\266"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"LongLeftArrow", "\342\237\265"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"iff", "\342\207\224"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Qopf", "\342\204\232"},
+		{"rlarr", "\342\207\204"},
+		{"supsetneq", "\342\212\213"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nap", "\342\211\211"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"shchcy", "\321\211"},
+		{NULL, NULL},
+		{"searrow", "\342\206\230"},
+		{NULL, NULL},
+		{"ddotseq", "\342\251\267"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Aopf", "\360\235\224\270"},
+		{NULL, NULL},
+		{"wreath", "\342\211\200"},
+		{NULL, NULL},
+		{"CapitalDifferentialD", "\342\205\205"},
+		{"succnsim", "\342\213\251"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"larr", "\342\206\220"},
+		{NULL, NULL},
+		{"NotLessGreater", "\342\211\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ufisht", "\342\245\276"},
+		{"primes", "\342\204\231"},
+		{"acE", "\342\210\276\314\263"},
+		{"gla", "\342\252\245"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rAtail", "\342\244\234"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"leftrightharpoons", "\342\207\213"},
+		{"quaternions", "\342\204\215"},
+		{"OverParenthesis", "\342\217\234"},
+		{"risingdotseq", "\342\211\223"},
+		{"NotSupersetEqual", "\342\212\211"},
+		{"bfr", "\360\235\224\237"},
+		{NULL, NULL},
+		{"sup1", "\302\271"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"twoheadrightarrow", "\342\206\240"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"prec", "\342\211\272"},
+		{"nequiv", "\342\211\242"},
+		{NULL, NULL},
+		{"rharu", "\342\207\200"},
+		{"colone", "\342\211\224"},
+		{NULL, NULL},
+		{"ominus", "\342\212\226"},
+		{NULL, NULL},
+		{"nwArr", "\342\207\226"},
+		{"sigmaf", "\317\202"},
+		{"dollar", "\044"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"div", "\303\267"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"HumpDownHump", "\342\211\216"},
+		{"raemptyv", "\342\246\263"},
+		{NULL, NULL},
+		{"scirc", "\305\235"},
+		{NULL, NULL},
+		{"percnt", "\045"},
+		{NULL, NULL},
+		{"fcy", "\321\204"},
+		{"mldr", "\342\200\246"},
+		{"uuarr", "\342\207\210"},
+		{NULL, NULL},
+		{"rang", "\342\237\251"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"odot", "\342\212\231"},
+		{"imath", "\304\261"},
+		{"Lcedil", "\304\273"},
+		{"NotLessLess", "\342\211\252\314\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"mumap", "\342\212\270"},
+		{NULL, NULL},
+		{"squ", "\342\226\241"},
+		{NULL, NULL},
+		{"Gammad", "\317\234"},
+		{NULL, NULL},
+		{"Kcy", "\320\232"},
+		{NULL, NULL},
+		{"Eta", "\316\227"},
+		{"xscr", "\360\235\223\215"},
+		{NULL, NULL},
+		{"barvee", "\342\212\275"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"scnE", "\342\252\266"},
+		{NULL, NULL},
+		{"tscy", "\321\206"},
+		{"lsquor", "\342\200\232"},
+		{"DiacriticalDot", "\313\231"},
+		{"ofr", "\360\235\224\254"},
+		{NULL, NULL},
+		{"nacute", "\305\204"},
+		{"nvle", "\342\211\244\342\203\222"},
+		{NULL, NULL},
+		{"lcedil", "\304\274"},
+		{"simg", "\342\252\236"},
+		{"DownRightTeeVector", "\342\245\237"},
+		{"Tau", "\316\244"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"pm", "\302\261"},
+		{"quatint", "\342\250\226"},
+		{NULL, NULL},
+		{"xlarr", "\342\237\265"},
+		{"Dashv", "\342\253\244"},
+		{NULL, NULL},
+		{"wp", "\342\204\230"},
+		{"Uarr", "\342\206\237"},
+		{NULL, NULL},
+		{"nldr", "\342\200\245"},
+		{"dtrif", "\342\226\276"},
+		{NULL, NULL},
+		{"OverBar", "\342\200\276"},
+		{"sdot", "\342\213\205"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"NestedLessLess", "\342\211\252"},
+		{"REG", "\302\256"},
+		{"vArr", "\342\207\225"},
+		{"ccedil", "\303\247"},
+		{"napprox", "\342\211\211"},
+		{"MinusPlus", "\342\210\223"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"bull", "\342\200\242"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Tcaron", "\305\244"},
+		{"KJcy", "\320\214"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Dscr", "\360\235\222\237"},
+		{"empty", "\342\210\205"},
+		{NULL, NULL},
+		{"Iuml", "\303\217"},
+		{"drcorn", "\342\214\237"},
+		{NULL, NULL},
+		{"downharpoonleft", "\342\207\203"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"naturals", "\342\204\225"},
+		{"boxur", "\342\224\224"},
+		{"rHar", "\342\245\244"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"caron", "\313\207"},
+		{NULL, NULL},
+		{"Ubrcy", "\320\216"},
+		{"hstrok", "\304\247"},
+		{"Ubreve", "\305\254"},
+		{"cupor", "\342\251\205"},
+		{"diamondsuit", "\342\231\246"},
+		{NULL, NULL},
+		{"ngsim", "\342\211\265"},
+		{"prurel", "\342\212\260"},
+		{NULL, NULL},
+		{"Re", "\342\204\234"},
+		{"blacksquare", "\342\226\252"},
+		{"plus", "\053"},
+		{"gammad", "\317\235"},
+		{NULL, NULL},
+		{"smte", "\342\252\254"},
+		{"Cconint", "\342\210\260"},
+		{"sqsupset", "\342\212\220"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"diam", "\342\213\204"},
+		{"uArr", "\342\207\221"},
+		{"pertenk", "\342\200\261"},
+		{"shortmid", "\342\210\243"},
+		{"gjcy", "\321\223"},
+		{"scpolint", "\342\250\223"},
+		{"curren", "\302\244"},
+		{NULL, NULL},
+		{"COPY", "\302\251"},
+		{NULL, NULL},
+		{"Topf", "\360\235\225\213"},
+		{NULL, NULL},
+		{"ntgl", "\342\211\271"},
+		{"ltri", "\342\227\203"},
+		{"gsime", "\342\252\216"},
+		{NULL, NULL},
+		{"popf", "\360\235\225\241"},
+		{NULL, NULL},
+		{"toea", "\342\244\250"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"DoubleUpDownArrow", "\342\207\225"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"plankv", "\342\204\217"},
+		{"andand", "\342\251\225"},
+		{NULL, NULL},
+		{"ltcir", "\342\251\271"},
+		{"NotGreater", "\342\211\257"},
+		{"ReverseElement", "\342\210\213"},
+		{"vsupne", "\342\212\213\357\270\200"},
+		{NULL, NULL},
+		{"gtreqqless", "\342\252\214"},
+		{NULL, NULL},
+		{"imof", "\342\212\267"},
+		{"acd", "\342\210\277"},
+		{"lessgtr", "\342\211\266"},
+		{"DoubleDownArrow", "\342\207\223"},
+		{"LessLess", "\342\252\241"},
+		{"blacktriangleright", "\342\226\270"},
+		{"nwarrow", "\342\206\226"},
+		{"horbar", "\342\200\225"},
+		{"npre", "\342\252\257\314\270"},
+		{NULL, NULL},
+		{"Or", "\342\251\224"},
+		{NULL, NULL},
+		{"ubreve", "\305\255"},
+		{"oscr", "\342\204\264"},
+		{"Iscr", "\342\204\220"},
+		{NULL, NULL},
+		{"iacute", "\303\255"},
+		{NULL, NULL},
+		{"boxul", "\342\224\230"},
+		{NULL, NULL},
+		{"gesdotol", "\342\252\204"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"NotPrecedesSlantEqual", "\342\213\240"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Nscr", "\360\235\222\251"},
+		{"Eogon", "\304\230"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Tfr", "\360\235\224\227"},
+		{NULL, NULL},
+		{"Sum", "\342\210\221"},
+		{"rBarr", "\342\244\217"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Ffr", "\360\235\224\211"},
+		{"Lambda", "\316\233"},
+		{NULL, NULL},
+		{"ZHcy", "\320\226"},
+		{"bemptyv", "\342\246\260"},
+		{"lsh", "\342\206\260"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"angmsdaa", "\342\246\250"},
+		{"lHar", "\342\245\242"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nLt", "\342\211\252\342\203\222"},
+		{NULL, NULL},
+		{"sung", "\342\231\252"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ShortDownArrow", "\342\206\223"},
+		{"bigsqcup", "\342\250\206"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rhov", "\317\261"},
+		{"cedil", "\302\270"},
+		{"notinE", "\342\213\271\314\270"},
+		{NULL, NULL},
+		{"cwconint", "\342\210\262"},
+		{"lbrace", "\173"},
+		{"szlig", "\303\237"},
+		{NULL, NULL},
+		{"uplus", "\342\212\216"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Jscr", "\360\235\222\245"},
+		{"Kscr", "\360\235\222\246"},
+		{"ldca", "\342\244\266"},
+		{"dtdot", "\342\213\261"},
+		{NULL, NULL},
+		{"ssmile", "\342\214\243"},
+		{NULL, NULL},
+		{"otimes", "\342\212\227"},
+		{NULL, NULL},
+		{"uuml", "\303\274"},
+		{"sub", "\342\212\202"},
+		{"LeftTriangleEqual", "\342\212\264"},
+		{"zacute", "\305\272"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"quest", "\077"},
+		{"race", "\342\210\275\314\261"},
+		{NULL, NULL},
+		{"succnapprox", "\342\252\272"},
+		{NULL, NULL},
+		{"YAcy", "\320\257"},
+		{"blacklozenge", "\342\247\253"},
+		{"mapstoup", "\342\206\245"},
+		{NULL, NULL},
+		{"nsupset", "\342\212\203\342\203\222"},
+		{"Zfr", "\342\204\250"},
+		{"softcy", "\321\214"},
+		{"isinsv", "\342\213\263"},
+		{NULL, NULL},
+		{"cwint", "\342\210\261"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"forkv", "\342\253\231"},
+		{"prE", "\342\252\263"},
+		{NULL, NULL},
+		{"vdash", "\342\212\242"},
+		{"Therefore", "\342\210\264"},
+		{"tstrok", "\305\247"},
+		{NULL, NULL},
+		{"wedgeq", "\342\211\231"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"telrec", "\342\214\225"},
+		{"trianglelefteq", "\342\212\264"},
+		{NULL, NULL},
+		{"eopf", "\360\235\225\226"},
+		{"npreceq", "\342\252\257\314\270"},
+		{NULL, NULL},
+		{"rightthreetimes", "\342\213\214"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"colon", "\072"},
+		{NULL, NULL},
+		{"lrhar", "\342\207\213"},
+		{NULL, NULL},
+		{"pluse", "\342\251\262"},
+		{NULL, NULL},
+		{"xharr", "\342\237\267"},
+		{NULL, NULL},
+		{"gtrdot", "\342\213\227"},
+		{"MediumSpace", "\342\201\237"},
+		{NULL, NULL},
+		{"gtdot", "\342\213\227"},
+		{"sim", "\342\210\274"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"NotSucceedsSlantEqual", "\342\213\241"},
+		{"dzigrarr", "\342\237\277"},
+		{"succapprox", "\342\252\270"},
+		{"conint", "\342\210\256"},
+		{"nsubset", "\342\212\202\342\203\222"},
+		{"nsupe", "\342\212\211"},
+		{NULL, NULL},
+		{"nless", "\342\211\256"},
+		{"apid", "\342\211\213"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ange", "\342\246\244"},
+		{"nedot", "\342\211\220\314\270"},
+		{"eqsim", "\342\211\202"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"centerdot", "\302\267"},
+		{"angrtvbd", "\342\246\235"},
+		{"igrave", "\303\254"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"notnivb", "\342\213\276"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"RightTeeVector", "\342\245\233"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"starf", "\342\230\205"},
+		{NULL, NULL},
+		{"thicksim", "\342\210\274"},
+		{NULL, NULL},
+		{"latail", "\342\244\231"},
+		{NULL, NULL},
+		{"napos", "\305\211"},
+		{"Tcy", "\320\242"},
+		{"rarrsim", "\342\245\264"},
+		{"hookleftarrow", "\342\206\251"},
+		{"ContourIntegral", "\342\210\256"},
+		{NULL, NULL},
+		{"supedot", "\342\253\204"},
+		{"Vdashl", "\342\253\246"},
+		{"between", "\342\211\254"},
+		{"ocir", "\342\212\232"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"bigcup", "\342\213\203"},
+		{NULL, NULL},
+		{"ultri", "\342\227\270"},
+		{"LeftTriangleBar", "\342\247\217"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"bigstar", "\342\230\205"},
+		{"Lsh", "\342\206\260"},
+		{"cent", "\302\242"},
+		{"lbrack", "\133"},
+		{"boxHU", "\342\225\251"},
+		{"csup", "\342\253\220"},
+		{NULL, NULL},
+		{"clubs", "\342\231\243"},
+		{"frac35", "\342\205\227"},
+		{"searr", "\342\206\230"},
+		{"precnsim", "\342\213\250"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"bsol", "\134"},
+		{NULL, NULL},
+		{"frac14", "\302\274"},
+		{"nVdash", "\342\212\256"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Vdash", "\342\212\251"},
+		{"LeftUpVector", "\342\206\277"},
+		{NULL, NULL},
+		{"Ccaron", "\304\214"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Amacr", "\304\200"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Yscr", "\360\235\222\264"},
+		{NULL, NULL},
+		{"Lt", "\342\211\252"},
+		{NULL, NULL},
+		{"map", "\342\206\246"},
+		{NULL, NULL},
+		{"approxeq", "\342\211\212"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Yopf", "\360\235\225\220"},
+		{NULL, NULL},
+		{"NotLessSlantEqual", "\342\251\275\314\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"DD", "\342\205\205"},
+		{"leq", "\342\211\244"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"xcup", "\342\213\203"},
+		{"para", "\302\266"},
+		{"diams", "\342\231\246"},
+		{"rbarr", "\342\244\215"},
+		{"ocy", "\320\276"},
+		{"wedbar", "\342\251\237"},
+		{NULL, NULL},
+		{"Updownarrow", "\342\207\225"},
+		{NULL, NULL},
+		{"rightarrowtail", "\342\206\243"},
+		{"ddarr", "\342\207\212"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rbbrk", "\342\235\263"},
+		{"varsigma", "\317\202"},
+		{"utilde", "\305\251"},
+		{"mp", "\342\210\223"},
+		{"Dot", "\302\250"},
+		{"Scaron", "\305\240"},
+		{NULL, NULL},
+		{"iota", "\316\271"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"plusdu", "\342\250\245"},
+		{"lurdshar", "\342\245\212"},
+		{NULL, NULL},
+		{"lnap", "\342\252\211"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Integral", "\342\210\253"},
+		{"YUcy", "\320\256"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"oslash", "\303\270"},
+		{"weierp", "\342\204\230"},
+		{"cong", "\342\211\205"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"chi", "\317\207"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"trpezium", "\342\217\242"},
+		{"vrtri", "\342\212\263"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"simrarr", "\342\245\262"},
+		{"nharr", "\342\206\256"},
+		{NULL, NULL},
+		{"ThinSpace", "\342\200\211"},
+		{NULL, NULL},
+		{"fjlig", "fj"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"DZcy", "\320\217"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Jukcy", "\320\204"},
+		{"subplus", "\342\252\277"},
+		{NULL, NULL},
+		{"qprime", "\342\201\227"},
+		{"nleftarrow", "\342\206\232"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Barv", "\342\253\247"},
+		{NULL, NULL},
+		{"bigtriangleup", "\342\226\263"},
+		{NULL, NULL},
+		{"Barwed", "\342\214\206"},
+		{"gg", "\342\211\253"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"divide", "\303\267"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"supset", "\342\212\203"},
+		{"uacute", "\303\272"},
+		{"RightTriangleEqual", "\342\212\265"},
+		{"Square", "\342\226\241"},
+		{NULL, NULL},
+		{"NotGreaterTilde", "\342\211\265"},
+		{NULL, NULL},
+		{"lang", "\342\237\250"},
+		{"lates", "\342\252\255\357\270\200"},
+		{"NotSubsetEqual", "\342\212\210"},
+		{"nearrow", "\342\206\227"},
+		{"ubrcy", "\321\236"},
+		{"boxUL", "\342\225\235"},
+		{NULL, NULL},
+		{"gtrsim", "\342\211\263"},
+		{NULL, NULL},
+		{"smashp", "\342\250\263"},
+		{"omicron", "\316\277"},
+		{NULL, NULL},
+		{"siml", "\342\252\235"},
+		{"leftharpoondown", "\342\206\275"},
+		{"leftharpoonup", "\342\206\274"},
+		{NULL, NULL},
+		{"Rcaron", "\305\230"},
+		{"sigma", "\317\203"},
+		{"Nfr", "\360\235\224\221"},
+		{"exponentiale", "\342\205\207"},
+		{"jopf", "\360\235\225\233"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Tstrok", "\305\246"},
+		{NULL, NULL},
+		{"nhpar", "\342\253\262"},
+		{"ltrif", "\342\227\202"},
+		{NULL, NULL},
+		{"NotHumpEqual", "\342\211\217\314\270"},
+		{"Igrave", "\303\214"},
+		{"lhard", "\342\206\275"},
+		{"sqsubset", "\342\212\217"},
+		{"gtquest", "\342\251\274"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"eqslantless", "\342\252\225"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"kjcy", "\321\234"},
+		{NULL, NULL},
+		{"cemptyv", "\342\246\262"},
+		{"models", "\342\212\247"},
+		{"smallsetminus", "\342\210\226"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Vert", "\342\200\226"},
+		{NULL, NULL},
+		{"egsdot", "\342\252\230"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"boxDR", "\342\225\224"},
+		{NULL, NULL},
+		{"ecolon", "\342\211\225"},
+		{"InvisibleComma", "\342\201\243"},
+		{NULL, NULL},
+		{"Dfr", "\360\235\224\207"},
+		{NULL, NULL},
+		{"urcorner", "\342\214\235"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"barwed", "\342\214\205"},
+		{"gEl", "\342\252\214"},
+		{"ShortRightArrow", "\342\206\222"},
+		{"cirscir", "\342\247\202"},
+		{"oline", "\342\200\276"},
+		{"Vbar", "\342\253\253"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"dscr", "\360\235\222\271"},
+		{NULL, NULL},
+		{"eparsl", "\342\247\243"},
+		{"LeftDownVector", "\342\207\203"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"RightCeiling", "\342\214\211"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"trisb", "\342\247\215"},
+		{NULL, NULL},
+		{"laquo", "\302\253"},
+		{"angst", "\303\205"},
+		{"gtlPar", "\342\246\225"},
+		{NULL, NULL},
+		{"varepsilon", "\317\265"},
+		{"realpart", "\342\204\234"},
+		{NULL, NULL},
+		{"varphi", "\317\225"},
+		{"trade", "\342\204\242"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rarrpl", "\342\245\205"},
+		{"Sfr", "\360\235\224\226"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"bopf", "\360\235\225\223"},
+		{"boxV", "\342\225\221"},
+		{"cupcup", "\342\251\212"},
+		{"rharul", "\342\245\254"},
+		{NULL, NULL},
+		{"Edot", "\304\226"},
+		{"supsetneqq", "\342\253\214"},
+		{"ijlig", "\304\263"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nsmid", "\342\210\244"},
+		{"bsime", "\342\213\215"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nsccue", "\342\213\241"},
+		{"bumpE", "\342\252\256"},
+		{NULL, NULL},
+		{"lcub", "\173"},
+		{"OverBrace", "\342\217\236"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Zscr", "\360\235\222\265"},
+		{NULL, NULL},
+		{"operp", "\342\246\271"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rightarrow", "\342\206\222"},
+		{"sc", "\342\211\273"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lsaquo", "\342\200\271"},
+		{"gsim", "\342\211\263"},
+		{"Kcedil", "\304\266"},
+		{"dashv", "\342\212\243"},
+		{"lbbrk", "\342\235\262"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nGt", "\342\211\253\342\203\222"},
+		{"ccups", "\342\251\214"},
+		{"AMP", "\046"},
+		{NULL, NULL},
+		{"barwedge", "\342\214\205"},
+		{NULL, NULL},
+		{"dotplus", "\342\210\224"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"or", "\342\210\250"},
+		{"nearr", "\342\206\227"},
+		{"SucceedsEqual", "\342\252\260"},
+		{NULL, NULL},
+		{"Racute", "\305\224"},
+		{"SmallCircle", "\342\210\230"},
+		{"iukcy", "\321\226"},
+		{NULL, NULL},
+		{"perp", "\342\212\245"},
+		{"rbrkslu", "\342\246\220"},
+		{"jfr", "\360\235\224\247"},
+		{"mid", "\342\210\243"},
+		{"boxvR", "\342\225\236"},
+		{"ugrave", "\303\271"},
+		{"ggg", "\342\213\231"},
+		{NULL, NULL},
+		{"rightleftarrows", "\342\207\204"},
+		{"vsubnE", "\342\253\213\357\270\200"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Jopf", "\360\235\225\201"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"gacute", "\307\265"},
+		{"cups", "\342\210\252\357\270\200"},
+		{"mscr", "\360\235\223\202"},
+		{"el", "\342\252\231"},
+		{"boxdr", "\342\224\214"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"gtrarr", "\342\245\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"hearts", "\342\231\245"},
+		{"ecirc", "\303\252"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ccaps", "\342\251\215"},
+		{NULL, NULL},
+		{"lobrk", "\342\237\246"},
+		{"ShortLeftArrow", "\342\206\220"},
+		{"blk12", "\342\226\222"},
+		{NULL, NULL},
+		{"backepsilon", "\317\266"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Cfr", "\342\204\255"},
+		{"varpi", "\317\226"},
+		{"Utilde", "\305\250"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"odsold", "\342\246\274"},
+		{"DownTeeArrow", "\342\206\247"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Kopf", "\360\235\225\202"},
+		{NULL, NULL},
+		{"Gamma", "\316\223"},
+		{"zcy", "\320\267"},
+		{NULL, NULL},
+		{"hArr", "\342\207\224"},
+		{NULL, NULL},
+		{"lesssim", "\342\211\262"},
+		{"SubsetEqual", "\342\212\206"},
+		{"looparrowright", "\342\206\254"},
+		{"Vee", "\342\213\201"},
+		{"swarr", "\342\206\231"},
+		{"questeq", "\342\211\237"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Iopf", "\360\235\225\200"},
+		{"notnivc", "\342\213\275"},
+		{"dd", "\342\205\206"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"puncsp", "\342\200\210"},
+		{"LeftUpVectorBar", "\342\245\230"},
+		{"xrArr", "\342\237\271"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"amalg", "\342\250\277"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"pitchfork", "\342\213\224"},
+		{"Tab", "\011"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"omacr", "\305\215"},
+		{NULL, NULL},
+		{"ycirc", "\305\267"},
+		{"kcedil", "\304\267"},
+		{"NotLeftTriangleEqual", "\342\213\254"},
+		{"mapstoleft", "\342\206\244"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Hstrok", "\304\246"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"squf", "\342\226\252"},
+		{"Del", "\342\210\207"},
+		{"SHCHcy", "\320\251"},
+		{"NotRightTriangle", "\342\213\253"},
+		{"RightArrowBar", "\342\207\245"},
+		{"NotSquareSupersetEqual", "\342\213\243"},
+		{"dstrok", "\304\221"},
+		{"urcorn", "\342\214\235"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"fltns", "\342\226\261"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Lfr", "\360\235\224\217"},
+		{"sup3", "\302\263"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"psi", "\317\210"},
+		{"Beta", "\316\222"},
+		{"iogon", "\304\257"},
+		{"angmsd", "\342\210\241"},
+		{NULL, NULL},
+		{"sqsube", "\342\212\221"},
+		{"updownarrow", "\342\206\225"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nwnear", "\342\244\247"},
+		{"llarr", "\342\207\207"},
+		{"cscr", "\360\235\222\270"},
+		{"nsubseteqq", "\342\253\205\314\270"},
+		{"rlhar", "\342\207\214"},
+		{"udarr", "\342\207\205"},
+		{"Star", "\342\213\206"},
+		{"ouml", "\303\266"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"boxbox", "\342\247\211"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"suplarr", "\342\245\273"},
+		{"filig", "\357\254\201"},
+		{"shy", "\302\255"},
+		{NULL, NULL},
+		{"Cross", "\342\250\257"},
+		{"orderof", "\342\204\264"},
+		{NULL, NULL},
+		{"rightsquigarrow", "\342\206\235"},
+		{"lsquo", "\342\200\230"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"varr", "\342\206\225"},
+		{"tcy", "\321\202"},
+		{"vzigzag", "\342\246\232"},
+		{NULL, NULL},
+		{"atilde", "\303\243"},
+		{NULL, NULL},
+		{"prap", "\342\252\267"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"zeetrf", "\342\204\250"},
+		{NULL, NULL},
+		{"excl", "\041"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"intlarhk", "\342\250\227"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"block", "\342\226\210"},
+		{"NotSquareSubset", "\342\212\217\314\270"},
+		{"because", "\342\210\265"},
+		{"Afr", "\360\235\224\204"},
+		{"nrtri", "\342\213\253"},
+		{"iscr", "\360\235\222\276"},
+		{"DoubleRightArrow", "\342\207\222"},
+		{NULL, NULL},
+		{"EqualTilde", "\342\211\202"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lne", "\342\252\207"},
+		{"oS", "\342\223\210"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lceil", "\342\214\210"},
+		{"euro", "\342\202\254"},
+		{NULL, NULL},
+		{"Cayleys", "\342\204\255"},
+		{NULL, NULL},
+		{"solb", "\342\247\204"},
+		{"GreaterLess", "\342\211\267"},
+		{"diamond", "\342\213\204"},
+		{"lneq", "\342\252\207"},
+		{"lAarr", "\342\207\232"},
+		{"Cacute", "\304\206"},
+		{"Pi", "\316\240"},
+		{NULL, NULL},
+		{"yicy", "\321\227"},
+		{NULL, NULL},
+		{"larrpl", "\342\244\271"},
+		{"af", "\342\201\241"},
+		{"UnderBracket", "\342\216\265"},
+		{NULL, NULL},
+		{"kopf", "\360\235\225\234"},
+		{"zcaron", "\305\276"},
+		{"hkswarow", "\342\244\246"},
+		{"ctdot", "\342\213\257"},
+		{NULL, NULL},
+		{"wr", "\342\211\200"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"bscr", "\360\235\222\267"},
+		{NULL, NULL},
+		{"thickapprox", "\342\211\210"},
+		{"yuml", "\303\277"},
+		{"napid", "\342\211\213\314\270"},
+		{NULL, NULL},
+		{"capbrcup", "\342\251\211"},
+		{"lopar", "\342\246\205"},
+		{"imped", "\306\265"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"NotLeftTriangleBar", "\342\247\217\314\270"},
+		{"varsubsetneq", "\342\212\212\357\270\200"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Ecy", "\320\255"},
+		{NULL, NULL},
+		{"Bcy", "\320\221"},
+		{"hyphen", "\342\200\220"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"frac34", "\302\276"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"NotRightTriangleEqual", "\342\213\255"},
+		{"Backslash", "\342\210\226"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"vltri", "\342\212\262"},
+		{"ii", "\342\205\210"},
+		{"kfr", "\360\235\224\250"},
+		{NULL, NULL},
+		{"nbsp", "\302\240"},
+		{"nsupseteq", "\342\212\211"},
+		{NULL, NULL},
+		{"eDot", "\342\211\221"},
+		{"nsqsube", "\342\213\242"},
+		{"nvltrie", "\342\212\264\342\203\222"},
+		{NULL, NULL},
+		{"Wcirc", "\305\264"},
+		{"subseteqq", "\342\253\205"},
+		{"xutri", "\342\226\263"},
+		{"nltri", "\342\213\252"},
+		{"NotSucceedsTilde", "\342\211\277\314\270"},
+		{"rtimes", "\342\213\212"},
+		{NULL, NULL},
+		{"emsp13", "\342\200\204"},
+		{"rarrfs", "\342\244\236"},
+		{"urcrop", "\342\214\216"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"dlcorn", "\342\214\236"},
+		{NULL, NULL},
+		{"DoubleVerticalBar", "\342\210\245"},
+		{"rthree", "\342\213\214"},
+		{"UnderParenthesis", "\342\217\235"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rbrace", "\175"},
+		{"prop", "\342\210\235"},
+		{NULL, NULL},
+		{"int", "\342\210\253"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Uacute", "\303\232"},
+		{NULL, NULL},
+		{"gl", "\342\211\267"},
+		{NULL, NULL},
+		{"llhard", "\342\245\253"},
+		{"rect", "\342\226\255"},
+		{NULL, NULL},
+		{"Chi", "\316\247"},
+		{"rx", "\342\204\236"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rtrie", "\342\212\265"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ngtr", "\342\211\257"},
+		{"llcorner", "\342\214\236"},
+		{"strns", "\302\257"},
+		{NULL, NULL},
+		{"veebar", "\342\212\273"},
+		{"Cedilla", "\302\270"},
+		{"square", "\342\226\241"},
+		{"rArr", "\342\207\222"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"gap", "\342\252\206"},
+		{NULL, NULL},
+		{"dfisht", "\342\245\277"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"vnsup", "\342\212\203\342\203\222"},
+		{"oelig", "\305\223"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nRightarrow", "\342\207\217"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lesdot", "\342\251\277"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rarrw", "\342\206\235"},
+		{"Pcy", "\320\237"},
+		{"scnap", "\342\252\272"},
+		{"uharl", "\342\206\277"},
+		{NULL, NULL},
+		{"Cdot", "\304\212"},
+		{NULL, NULL},
+		{"bigodot", "\342\250\200"},
+		{"Ncedil", "\305\205"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"disin", "\342\213\262"},
+		{"subsetneqq", "\342\253\213"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"looparrowleft", "\342\206\253"},
+		{"die", "\302\250"},
+		{"nprcue", "\342\213\240"},
+		{"ncap", "\342\251\203"},
+		{"rppolint", "\342\250\222"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rpargt", "\342\246\224"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lfisht", "\342\245\274"},
+		{NULL, NULL},
+		{"lescc", "\342\252\250"},
+		{NULL, NULL},
+		{"IJlig", "\304\262"},
+		{"frown", "\342\214\242"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"DownLeftVector", "\342\206\275"},
+		{"Longrightarrow", "\342\237\271"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"intercal", "\342\212\272"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"supmult", "\342\253\202"},
+		{"iiiint", "\342\250\214"},
+		{"mnplus", "\342\210\223"},
+		{"dotminus", "\342\210\270"},
+		{"UnionPlus", "\342\212\216"},
+		{NULL, NULL},
+		{"Wscr", "\360\235\222\262"},
+		{"DoubleLongLeftRightArrow", "\342\237\272"},
+		{NULL, NULL},
+		{"permil", "\342\200\260"},
+		{"Itilde", "\304\250"},
+		{NULL, NULL},
+		{"ovbar", "\342\214\275"},
+		{"Ouml", "\303\226"},
+		{"OpenCurlyDoubleQuote", "\342\200\234"},
+		{"rationals", "\342\204\232"},
+		{NULL, NULL},
+		{"solbar", "\342\214\277"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"TRADE", "\342\204\242"},
+		{"Otimes", "\342\250\267"},
+		{"xcap", "\342\213\202"},
+		{"Jcirc", "\304\264"},
+		{"lsqb", "\133"},
+		{"supsim", "\342\253\210"},
+		{NULL, NULL},
+		{"Kfr", "\360\235\224\216"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nbumpe", "\342\211\217\314\270"},
+		{"Ycy", "\320\253"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"copysr", "\342\204\227"},
+		{NULL, NULL},
+		{"LessEqualGreater", "\342\213\232"},
+		{"not", "\302\254"},
+		{NULL, NULL},
+		{"olcir", "\342\246\276"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"phiv", "\317\225"},
+		{"nleqq", "\342\211\246\314\270"},
+		{NULL, NULL},
+		{"bne", "\075\342\203\245"},
+		{NULL, NULL},
+		{"mfr", "\360\235\224\252"},
+		{"circledast", "\342\212\233"},
+		{"Gfr", "\360\235\224\212"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"gnap", "\342\252\212"},
+		{"langle", "\342\237\250"},
+		{"TildeEqual", "\342\211\203"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ycy", "\321\213"},
+		{"VerticalTilde", "\342\211\200"},
+		{NULL, NULL},
+		{"NotLessEqual", "\342\211\260"},
+		{"SucceedsSlantEqual", "\342\211\275"},
+		{"awint", "\342\250\221"},
+		{"ape", "\342\211\212"},
+		{"ngt", "\342\211\257"},
+		{NULL, NULL},
+		{"aopf", "\360\235\225\222"},
+		{NULL, NULL},
+		{"NotTildeFullEqual", "\342\211\207"},
+		{"LeftTee", "\342\212\243"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"setmn", "\342\210\226"},
+		{"vartheta", "\317\221"},
+		{"range", "\342\246\245"},
+		{NULL, NULL},
+		{"racute", "\305\225"},
+		{"ge", "\342\211\245"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"GreaterFullEqual", "\342\211\247"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"leftrightarrow", "\342\206\224"},
+		{"orarr", "\342\206\273"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Poincareplane", "\342\204\214"},
+		{"Breve", "\313\230"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"exist", "\342\210\203"},
+		{"subseteq", "\342\212\206"},
+		{"nvap", "\342\211\215\342\203\222"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nparsl", "\342\253\275\342\203\245"},
+		{"orv", "\342\251\233"},
+		{"curlyeqprec", "\342\213\236"},
+		{NULL, NULL},
+		{"Mu", "\316\234"},
+		{"boxDr", "\342\225\223"},
+		{"uhblk", "\342\226\200"},
+		{"kscr", "\360\235\223\200"},
+		{"rcy", "\321\200"},
+		{"simplus", "\342\250\244"},
+		{"capcap", "\342\251\213"},
+		{"supseteqq", "\342\253\206"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Sub", "\342\213\220"},
+		{"NotGreaterSlantEqual", "\342\251\276\314\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Lmidot", "\304\277"},
+		{"DiacriticalTilde", "\313\234"},
+		{NULL, NULL},
+		{"NotSubset", "\342\212\202\342\203\222"},
+		{"Scirc", "\305\234"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Sigma", "\316\243"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"jcy", "\320\271"},
+		{NULL, NULL},
+		{"ccupssm", "\342\251\220"},
+		{"roang", "\342\237\255"},
+		{NULL, NULL},
+		{"LeftUpDownVector", "\342\245\221"},
+		{"nsc", "\342\212\201"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lacute", "\304\272"},
+		{"egs", "\342\252\226"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"acirc", "\303\242"},
+		{"hamilt", "\342\204\213"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"boxv", "\342\224\202"},
+		{"leftthreetimes", "\342\213\213"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"midast", "\052"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"thorn", "\303\276"},
+		{NULL, NULL},
+		{"UpArrowDownArrow", "\342\207\205"},
+		{"esdot", "\342\211\220"},
+		{NULL, NULL},
+		{"UpTee", "\342\212\245"},
+		{"pfr", "\360\235\224\255"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"boxuR", "\342\225\230"},
+		{NULL, NULL},
+		{"eta", "\316\267"},
+		{"ni", "\342\210\213"},
+		{"RuleDelayed", "\342\247\264"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"SupersetEqual", "\342\212\207"},
+		{NULL, NULL},
+		{"copy", "\302\251"},
+		{"Mscr", "\342\204\263"},
+		{"efr", "\360\235\224\242"},
+		{"in", "\342\210\210"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"hksearow", "\342\244\245"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"tint", "\342\210\255"},
+		{"cirfnint", "\342\250\220"},
+		{NULL, NULL},
+		{"DScy", "\320\205"},
+		{NULL, NULL},
+		{"Larr", "\342\206\236"},
+		{"djcy", "\321\222"},
+		{NULL, NULL},
+		{"daleth", "\342\204\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"RightDownTeeVector", "\342\245\235"},
+		{NULL, NULL},
+		{"mcomma", "\342\250\251"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nvsim", "\342\210\274\342\203\222"},
+		{"mu", "\316\274"},
+		{NULL, NULL},
+		{"Darr", "\342\206\241"},
+		{NULL, NULL},
+		{"rtri", "\342\226\271"},
+		{"NegativeThickSpace", "\342\200\213"},
+		{"commat", "\100"},
+		{"rarrlp", "\342\206\254"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"boxdR", "\342\225\222"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"supsup", "\342\253\226"},
+		{"Auml", "\303\204"},
+		{NULL, NULL},
+		{"Acy", "\320\220"},
+		{"times", "\303\227"},
+		{"rsquo", "\342\200\231"},
+		{NULL, NULL},
+		{"Qscr", "\360\235\222\254"},
+		{NULL, NULL},
+		{"eplus", "\342\251\261"},
+		{"npr", "\342\212\200"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"late", "\342\252\255"},
+		{"SucceedsTilde", "\342\211\277"},
+		{"RightArrow", "\342\206\222"},
+		{NULL, NULL},
+		{"bottom", "\342\212\245"},
+		{"Oacute", "\303\223"},
+		{"cir", "\342\227\213"},
+		{NULL, NULL},
+		{"Cscr", "\360\235\222\236"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"csube", "\342\253\221"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"supne", "\342\212\213"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"sime", "\342\211\203"},
+		{NULL, NULL},
+		{"Rarrtl", "\342\244\226"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lesdotor", "\342\252\203"},
+		{NULL, NULL},
+		{"top", "\342\212\244"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"bigvee", "\342\213\201"},
+		{NULL, NULL},
+		{"eqcolon", "\342\211\225"},
+		{"coprod", "\342\210\220"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"cuesc", "\342\213\237"},
+		{"angmsdac", "\342\246\252"},
+		{NULL, NULL},
+		{"csupe", "\342\253\222"},
+		{"nsqsupe", "\342\213\243"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Hfr", "\342\204\214"},
+		{"FilledSmallSquare", "\342\227\274"},
+		{NULL, NULL},
+		{"precnapprox", "\342\252\271"},
+		{"boxUr", "\342\225\231"},
+		{"bdquo", "\342\200\236"},
+		{NULL, NULL},
+		{"triangleright", "\342\226\271"},
+		{NULL, NULL},
+		{"checkmark", "\342\234\223"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"trie", "\342\211\234"},
+		{NULL, NULL},
+		{"lharul", "\342\245\252"},
+		{"zscr", "\360\235\223\217"},
+		{"CHcy", "\320\247"},
+		{NULL, NULL},
+		{"Fcy", "\320\244"},
+		{"cularr", "\342\206\266"},
+		{NULL, NULL},
+		{"image", "\342\204\221"},
+		{"circledR", "\302\256"},
+		{NULL, NULL},
+		{"ac", "\342\210\276"},
+		{NULL, NULL},
+		{"Zdot", "\305\273"},
+		{NULL, NULL},
+		{"nvlt", "\074\342\203\222"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ClockwiseContourIntegral", "\342\210\262"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ulcrop", "\342\214\217"},
+		{NULL, NULL},
+		{"notindot", "\342\213\265\314\270"},
+		{"NotVerticalBar", "\342\210\244"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"uopf", "\360\235\225\246"},
+		{"blacktriangledown", "\342\226\276"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"prod", "\342\210\217"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"NotNestedLessLess", "\342\252\241\314\270"},
+		{NULL, NULL},
+		{"Int", "\342\210\254"},
+		{"boxVL", "\342\225\243"},
+		{"rcub", "\175"},
+		{NULL, NULL},
+		{"nleftrightarrow", "\342\206\256"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nang", "\342\210\240\342\203\222"},
+		{"sqsub", "\342\212\217"},
+		{"RightDownVector", "\342\207\202"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"tprime", "\342\200\264"},
+		{NULL, NULL},
+		{"boxhD", "\342\225\245"},
+		{"mho", "\342\204\247"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Dcaron", "\304\216"},
+		{NULL, NULL},
+		{"circeq", "\342\211\227"},
+		{"Mfr", "\360\235\224\220"},
+		{NULL, NULL},
+		{"nmid", "\342\210\244"},
+		{"cuepr", "\342\213\236"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"geqq", "\342\211\247"},
+		{"tcedil", "\305\243"},
+		{"RightDownVectorBar", "\342\245\225"},
+		{NULL, NULL},
+		{"smt", "\342\252\252"},
+		{"nrarrw", "\342\206\235\314\270"},
+		{"Diamond", "\342\213\204"},
+		{"UpDownArrow", "\342\206\225"},
+		{"LeftTriangle", "\342\212\262"},
+		{"angzarr", "\342\215\274"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"minus", "\342\210\222"},
+		{NULL, NULL},
+		{"lt", "\074"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Sscr", "\360\235\222\256"},
+		{NULL, NULL},
+		{"lnE", "\342\211\250"},
+		{"Bernoullis", "\342\204\254"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Icirc", "\303\216"},
+		{NULL, NULL},
+		{"LeftUpTeeVector", "\342\245\240"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"cudarrl", "\342\244\270"},
+		{"UpperLeftArrow", "\342\206\226"},
+		{"gneq", "\342\252\210"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Yuml", "\305\270"},
+		{"xopf", "\360\235\225\251"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ucy", "\321\203"},
+		{"lbrkslu", "\342\246\215"},
+		{"mdash", "\342\200\224"},
+		{"backcong", "\342\211\214"},
+		{NULL, NULL},
+		{"Wopf", "\360\235\225\216"},
+		{NULL, NULL},
+		{"utdot", "\342\213\260"},
+		{"uscr", "\360\235\223\212"},
+		{NULL, NULL},
+		{"boxDL", "\342\225\227"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"jukcy", "\321\224"},
+		{NULL, NULL},
+		{"DownTee", "\342\212\244"},
+		{"lmoust", "\342\216\260"},
+		{NULL, NULL},
+		{"tilde", "\313\234"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"pr", "\342\211\272"},
+		{NULL, NULL},
+		{"Vscr", "\360\235\222\261"},
+		{"hcirc", "\304\245"},
+		{"Ugrave", "\303\231"},
+		{NULL, NULL},
+		{"NoBreak", "\342\201\240"},
+		{NULL, NULL},
+		{"spadesuit", "\342\231\240"},
+		{NULL, NULL},
+		{"UpEquilibrium", "\342\245\256"},
+		{"bigoplus", "\342\250\201"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"xhArr", "\342\237\272"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"notni", "\342\210\214"},
+		{NULL, NULL},
+		{"isin", "\342\210\210"},
+		{NULL, NULL},
+		{"prnap", "\342\252\271"},
+		{"ncaron", "\305\210"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"umacr", "\305\253"},
+		{"subsim", "\342\253\207"},
+		{NULL, NULL},
+		{"Oslash", "\303\230"},
+		{"nleqslant", "\342\251\275\314\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"curlyvee", "\342\213\216"},
+		{NULL, NULL},
+		{"gamma", "\316\263"},
+		{"nvge", "\342\211\245\342\203\222"},
+		{"NotSucceedsEqual", "\342\252\260\314\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"THORN", "\303\236"},
+		{"ltdot", "\342\213\226"},
+		{NULL, NULL},
+		{"sfrown", "\342\214\242"},
+		{"vscr", "\360\235\223\213"},
+		{NULL, NULL},
+		{"Uuml", "\303\234"},
+		{NULL, NULL},
+		{"RightUpVectorBar", "\342\245\224"},
+		{"boxHu", "\342\225\247"},
+		{"Popf", "\342\204\231"},
+		{"Coproduct", "\342\210\220"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ntilde", "\303\261"},
+		{NULL, NULL},
+		{"and", "\342\210\247"},
+		{"HorizontalLine", "\342\224\200"},
+		{"sqcup", "\342\212\224"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"suphsol", "\342\237\211"},
+		{"oint", "\342\210\256"},
+		{"Pfr", "\360\235\224\223"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"smile", "\342\214\243"},
+		{NULL, NULL},
+		{"npolint", "\342\250\224"},
+		{"longleftrightarrow", "\342\237\267"},
+		{"LeftArrowBar", "\342\207\244"},
+		{"realine", "\342\204\233"},
+		{"Ograve", "\303\222"},
+		{"geq", "\342\211\245"},
+		{"blk34", "\342\226\223"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ensp", "\342\200\202"},
+		{"xlArr", "\342\237\270"},
+		{NULL, NULL},
+		{"InvisibleTimes", "\342\201\242"},
+		{"cularrp", "\342\244\275"},
+		{NULL, NULL},
+		{"ldrdhar", "\342\245\247"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"DownArrowBar", "\342\244\223"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"NestedGreaterGreater", "\342\211\253"},
+		{NULL, NULL},
+		{"rfr", "\360\235\224\257"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rlm", "\342\200\217"},
+		{"nwarhk", "\342\244\243"},
+		{NULL, NULL},
+		{"Rang", "\342\237\253"},
+		{"eng", "\305\213"},
+		{"gvertneqq", "\342\211\251\357\270\200"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Acirc", "\303\202"},
+		{"boxvl", "\342\224\244"},
+		{"sol", "\057"},
+		{NULL, NULL},
+		{"lmoustache", "\342\216\260"},
+		{"emptyv", "\342\210\205"},
+		{NULL, NULL},
+		{"QUOT", "\042"},
+		{"ApplyFunction", "\342\201\241"},
+		{NULL, NULL},
+		{"angle", "\342\210\240"},
+		{"cylcty", "\342\214\255"},
+		{NULL, NULL},
+		{"rangle", "\342\237\251"},
+		{NULL, NULL},
+		{"blk14", "\342\226\221"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"mapsto", "\342\206\246"},
+		{"lneqq", "\342\211\250"},
+		{"rarrbfs", "\342\244\240"},
+		{"nhArr", "\342\207\216"},
+		{"aelig", "\303\246"},
+		{"eacute", "\303\251"},
+		{"aring", "\303\245"},
+		{NULL, NULL},
+		{"mapstodown", "\342\206\247"},
+		{NULL, NULL},
+		{"jmath", "\310\267"},
+		{NULL, NULL},
+		{"LeftVector", "\342\206\274"},
+		{"triangleq", "\342\211\234"},
+		{NULL, NULL},
+		{"ohbar", "\342\246\265"},
+		{"gneqq", "\342\211\251"},
+		{NULL, NULL},
+		{"Rcedil", "\305\226"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nges", "\342\251\276\314\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"pi", "\317\200"},
+		{"dopf", "\360\235\225\225"},
+		{"Gcy", "\320\223"},
+		{NULL, NULL},
+		{"Mcy", "\320\234"},
+		{"nshortparallel", "\342\210\246"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"gtcir", "\342\251\272"},
+		{"angrtvb", "\342\212\276"},
+		{NULL, NULL},
+		{"circlearrowleft", "\342\206\272"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"DownRightVector", "\342\207\201"},
+		{"Atilde", "\303\203"},
+		{"Leftrightarrow", "\342\207\224"},
+		{"RoundImplies", "\342\245\260"},
+		{"lnsim", "\342\213\246"},
+		{"theta", "\316\270"},
+		{"nlarr", "\342\206\232"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"esim", "\342\211\202"},
+		{"LeftDoubleBracket", "\342\237\246"},
+		{"Phi", "\316\246"},
+		{"Sup", "\342\213\221"},
+		{"SquareSubset", "\342\212\217"},
+		{NULL, NULL},
+		{"VerticalLine", "\174"},
+		{"ncedil", "\305\206"},
+		{NULL, NULL},
+		{"gescc", "\342\252\251"},
+		{"downharpoonright", "\342\207\202"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"yopf", "\360\235\225\252"},
+		{"asymp", "\342\211\210"},
+		{"ltrie", "\342\212\264"},
+		{"ZeroWidthSpace", "\342\200\213"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"doublebarwedge", "\342\214\206"},
+		{"iopf", "\360\235\225\232"},
+		{"DownLeftVectorBar", "\342\245\226"},
+		{"nsub", "\342\212\204"},
+		{NULL, NULL},
+		{"PartialD", "\342\210\202"},
+		{NULL, NULL},
+		{"nu", "\316\275"},
+		{"simeq", "\342\211\203"},
+		{"gtrless", "\342\211\267"},
+		{"sigmav", "\317\202"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"planck", "\342\204\217"},
+		{"upharpoonleft", "\342\206\277"},
+		{NULL, NULL},
+		{"bsim", "\342\210\275"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"trianglerighteq", "\342\212\265"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Aacute", "\303\201"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"equivDD", "\342\251\270"},
+		{"frac16", "\342\205\231"},
+		{NULL, NULL},
+		{"lotimes", "\342\250\264"},
+		{"napE", "\342\251\260\314\270"},
+		{"subne", "\342\212\212"},
+		{"natur", "\342\231\256"},
+		{"angmsdab", "\342\246\251"},
+		{"angrt", "\342\210\237"},
+		{"rbrack", "\135"},
+		{"NotSuperset", "\342\212\203\342\203\222"},
+		{"subdot", "\342\252\275"},
+		{"zeta", "\316\266"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"vsubne", "\342\212\212\357\270\200"},
+		{NULL, NULL},
+		{"glj", "\342\252\244"},
+		{"Qfr", "\360\235\224\224"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"NotGreaterEqual", "\342\211\261"},
+		{"compfn", "\342\210\230"},
+		{"rmoustache", "\342\216\261"},
+		{"NotCongruent", "\342\211\242"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"middot", "\302\267"},
+		{NULL, NULL},
+		{"Cup", "\342\213\223"},
+		{NULL, NULL},
+		{"otimesas", "\342\250\266"},
+		{"rsquor", "\342\200\231"},
+		{NULL, NULL},
+		{"circledS", "\342\223\210"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lesg", "\342\213\232\357\270\200"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"boxvH", "\342\225\252"},
+		{"star", "\342\230\206"},
+		{NULL, NULL},
+		{"lEg", "\342\252\213"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Rsh", "\342\206\261"},
+		{NULL, NULL},
+		{"NotDoubleVerticalBar", "\342\210\246"},
+		{"cap", "\342\210\251"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Oscr", "\360\235\222\252"},
+		{"Hacek", "\313\207"},
+		{"Rrightarrow", "\342\207\233"},
+		{NULL, NULL},
+		{"Intersection", "\342\213\202"},
+		{NULL, NULL},
+		{"equals", "\075"},
+		{NULL, NULL},
+		{"GreaterSlantEqual", "\342\251\276"},
+		{"Supset", "\342\213\221"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"iiint", "\342\210\255"},
+		{NULL, NULL},
+		{"profsurf", "\342\214\223"},
+		{"ndash", "\342\200\223"},
+		{"Lang", "\342\237\252"},
+		{"xwedge", "\342\213\200"},
+		{"Ecirc", "\303\212"},
+		{"dzcy", "\321\237"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"DoubleLeftTee", "\342\253\244"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"RBarr", "\342\244\220"},
+		{NULL, NULL},
+		{"CounterClockwiseContourIntegral", "\342\210\263"},
+		{"sdotb", "\342\212\241"},
+		{"varsupsetneq", "\342\212\213\357\270\200"},
+		{"approx", "\342\211\210"},
+		{NULL, NULL},
+		{"ncongdot", "\342\251\255\314\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nltrie", "\342\213\254"},
+		{"ffr", "\360\235\224\243"},
+		{NULL, NULL},
+		{"oplus", "\342\212\225"},
+		{"measuredangle", "\342\210\241"},
+		{"rho", "\317\201"},
+		{"plusmn", "\302\261"},
+		{"lessapprox", "\342\252\205"},
+		{"cudarrr", "\342\244\265"},
+		{NULL, NULL},
+		{"Ecaron", "\304\232"},
+		{"DownArrow", "\342\206\223"},
+		{"rdldhar", "\342\245\251"},
+		{"Aring", "\303\205"},
+		{"triangledown", "\342\226\277"},
+		{"clubsuit", "\342\231\243"},
+		{"loang", "\342\237\254"},
+		{"par", "\342\210\245"},
+		{NULL, NULL},
+		{"escr", "\342\204\257"},
+		{NULL, NULL},
+		{"varpropto", "\342\210\235"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Ufr", "\360\235\224\230"},
+		{"NotTildeTilde", "\342\211\211"},
+		{"langd", "\342\246\221"},
+		{NULL, NULL},
+		{"Longleftrightarrow", "\342\237\272"},
+		{"longleftarrow", "\342\237\265"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"supdot", "\342\252\276"},
+		{"Vvdash", "\342\212\252"},
+		{"RightArrowLeftArrow", "\342\207\204"},
+		{"Gcirc", "\304\234"},
+		{NULL, NULL},
+		{"ges", "\342\251\276"},
+		{"phone", "\342\230\216"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"simdot", "\342\251\252"},
+		{"vBar", "\342\253\250"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lrarr", "\342\207\206"},
+		{NULL, NULL},
+		{"numsp", "\342\200\207"},
+		{"angmsdag", "\342\246\256"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"cirmid", "\342\253\257"},
+		{NULL, NULL},
+		{"profalar", "\342\214\256"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lessdot", "\342\213\226"},
+		{NULL, NULL},
+		{"lsime", "\342\252\215"},
+		{"topfork", "\342\253\232"},
+		{"rightleftharpoons", "\342\207\214"},
+		{"Lleftarrow", "\342\207\232"},
+		{NULL, NULL},
+		{"Tscr", "\360\235\222\257"},
+		{"ENG", "\305\212"},
+		{"succcurlyeq", "\342\211\275"},
+		{NULL, NULL},
+		{"ulcorn", "\342\214\234"},
+		{"oast", "\342\212\233"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"expectation", "\342\204\260"},
+		{"imagpart", "\342\204\221"},
+		{NULL, NULL},
+		{"notinva", "\342\210\211"},
+		{"zdot", "\305\274"},
+		{"nvrArr", "\342\244\203"},
+		{"RightUpVector", "\342\206\276"},
+		{"nis", "\342\213\274"},
+		{"oror", "\342\251\226"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lsim", "\342\211\262"},
+		{"vprop", "\342\210\235"},
+		{"bepsi", "\317\266"},
+		{"tcaron", "\305\245"},
+		{"swarrow", "\342\206\231"},
+		{"LessSlantEqual", "\342\251\275"},
+		{NULL, NULL},
+		{"bernou", "\342\204\254"},
+		{"mstpos", "\342\210\276"},
+		{NULL, NULL},
+		{"triangle", "\342\226\265"},
+		{NULL, NULL},
+		{"ccaron", "\304\215"},
+		{"DoubleLongLeftArrow", "\342\237\270"},
+		{"Lacute", "\304\271"},
+		{"Congruent", "\342\211\241"},
+		{"gnsim", "\342\213\247"},
+		{"subrarr", "\342\245\271"},
+		{NULL, NULL},
+		{"notinvc", "\342\213\266"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Umacr", "\305\252"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"longmapsto", "\342\237\274"},
+		{"EmptySmallSquare", "\342\227\273"},
+		{"xoplus", "\342\250\201"},
+		{"HumpEqual", "\342\211\217"},
+		{"Euml", "\303\213"},
+		{"num", "\043"},
+		{"plustwo", "\342\250\247"},
+		{NULL, NULL},
+		{"GT", "\076"},
+		{"Ccedil", "\303\207"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ForAll", "\342\210\200"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"vfr", "\360\235\224\263"},
+		{"le", "\342\211\244"},
+		{"Iogon", "\304\256"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"NJcy", "\320\212"},
+		{"uring", "\305\257"},
+		{"ntrianglelefteq", "\342\213\254"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"isins", "\342\213\264"},
+		{"sqcups", "\342\212\224\357\270\200"},
+		{"gcy", "\320\263"},
+		{NULL, NULL},
+		{"NotLeftTriangle", "\342\213\252"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"isindot", "\342\213\265"},
+		{NULL, NULL},
+		{"Escr", "\342\204\260"},
+		{NULL, NULL},
+		{"Implies", "\342\207\222"},
+		{NULL, NULL},
+		{"lBarr", "\342\244\216"},
+		{"zfr", "\360\235\224\267"},
+		{"upsilon", "\317\205"},
+		{"Nacute", "\305\203"},
+		{"olt", "\342\247\200"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Uogon", "\305\262"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"CupCap", "\342\211\215"},
+		{"LessFullEqual", "\342\211\246"},
+		{"NotPrecedesEqual", "\342\252\257\314\270"},
+		{NULL, NULL},
+		{"lat", "\342\252\253"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Kappa", "\316\232"},
+		{"nsime", "\342\211\204"},
+		{NULL, NULL},
+		{"aleph", "\342\204\265"},
+		{NULL, NULL},
+		{"elsdot", "\342\252\227"},
+		{"curlyeqsucc", "\342\213\237"},
+		{"bumpeq", "\342\211\217"},
+		{"uml", "\302\250"},
+		{"plusacir", "\342\250\243"},
+		{NULL, NULL},
+		{"thetav", "\317\221"},
+		{"caret", "\342\201\201"},
+		{"Equilibrium", "\342\207\214"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"boxhd", "\342\224\254"},
+		{NULL, NULL},
+		{"succsim", "\342\211\277"},
+		{"iuml", "\303\257"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"boxVr", "\342\225\237"},
+		{"minusb", "\342\212\237"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Prime", "\342\200\263"},
+		{"ast", "\052"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"wscr", "\360\235\223\214"},
+		{"divideontimes", "\342\213\207"},
+		{"LeftTeeArrow", "\342\206\244"},
+		{"sext", "\342\234\266"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Uring", "\305\256"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"alefsym", "\342\204\265"},
+		{NULL, NULL},
+		{"upsi", "\317\205"},
+		{"Jcy", "\320\231"},
+		{"homtht", "\342\210\273"},
+		{"hardcy", "\321\212"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"boxdl", "\342\224\220"},
+		{NULL, NULL},
+		{"rarr", "\342\206\222"},
+		{NULL, NULL},
+		{"propto", "\342\210\235"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"flat", "\342\231\255"},
+		{"Zopf", "\342\204\244"},
+		{NULL, NULL},
+		{"PrecedesEqual", "\342\252\257"},
+		{"drcrop", "\342\214\214"},
+		{NULL, NULL},
+		{"ulcorner", "\342\214\234"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"DoubleContourIntegral", "\342\210\257"},
+		{"omega", "\317\211"},
+		{"gcirc", "\304\235"},
+		{"digamma", "\317\235"},
+		{"DoubleDot", "\302\250"},
+		{"tau", "\317\204"},
+		{"PrecedesSlantEqual", "\342\211\274"},
+		{NULL, NULL},
+		{"boxDl", "\342\225\226"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"NotLess", "\342\211\256"},
+		{"Ncaron", "\305\207"},
+		{NULL, NULL},
+		{"leqq", "\342\211\246"},
+		{"gesdoto", "\342\252\202"},
+		{"rightharpoondown", "\342\207\201"},
+		{"leftleftarrows", "\342\207\207"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"andv", "\342\251\232"},
+		{"DoubleLongRightArrow", "\342\237\271"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"odblac", "\305\221"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"bigwedge", "\342\213\200"},
+		{"cire", "\342\211\227"},
+		{NULL, NULL},
+		{"Wfr", "\360\235\224\232"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"RightVector", "\342\207\200"},
+		{"nwarr", "\342\206\226"},
+		{NULL, NULL},
+		{"NotCupCap", "\342\211\255"},
+		{"dscy", "\321\225"},
+		{"rnmid", "\342\253\256"},
+		{"iquest", "\302\277"},
+		{"wcirc", "\305\265"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"blank", "\342\220\243"},
+		{NULL, NULL},
+		{"prcue", "\342\211\274"},
+		{"subedot", "\342\253\203"},
+		{NULL, NULL},
+		{"congdot", "\342\251\255"},
+		{"curlywedge", "\342\213\217"},
+		{NULL, NULL},
+		{"RightUpTeeVector", "\342\245\234"},
+		{NULL, NULL},
+		{"supseteq", "\342\212\207"},
+		{"frac15", "\342\205\225"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"apos", "\047"},
+		{"gimel", "\342\204\267"},
+		{"larrtl", "\342\206\242"},
+		{NULL, NULL},
+		{"Cap", "\342\213\222"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"DownLeftRightVector", "\342\245\220"},
+		{NULL, NULL},
+		{"gopf", "\360\235\225\230"},
+		{"inodot", "\304\261"},
+		{"gnapprox", "\342\252\212"},
+		{NULL, NULL},
+		{"dcaron", "\304\217"},
+		{"icy", "\320\270"},
+		{"straightphi", "\317\225"},
+		{"vcy", "\320\262"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"erDot", "\342\211\223"},
+		{"shortparallel", "\342\210\245"},
+		{"pointint", "\342\250\225"},
+		{"Dstrok", "\304\220"},
+		{"uparrow", "\342\206\221"},
+		{"nsimeq", "\342\211\204"},
+		{NULL, NULL},
+		{"larrhk", "\342\206\251"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Omacr", "\305\214"},
+		{"eg", "\342\252\232"},
+		{NULL, NULL},
+		{"rotimes", "\342\250\265"},
+		{"rfisht", "\342\245\275"},
+		{"boxminus", "\342\212\237"},
+		{NULL, NULL},
+		{"qopf", "\360\235\225\242"},
+		{"ldquo", "\342\200\234"},
+		{"DownBreve", "\314\221"},
+		{NULL, NULL},
+		{"nsubseteq", "\342\212\210"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Tcedil", "\305\242"},
+		{"gscr", "\342\204\212"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"RightAngleBracket", "\342\237\251"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nvDash", "\342\212\255"},
+		{"nsim", "\342\211\201"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"curarrm", "\342\244\274"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"comp", "\342\210\201"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nvrtrie", "\342\212\265\342\203\222"},
+		{NULL, NULL},
+		{"thkap", "\342\211\210"},
+		{"ogt", "\342\247\201"},
+		{NULL, NULL},
+		{"upharpoonright", "\342\206\276"},
+		{"Gg", "\342\213\231"},
+		{"dharr", "\342\207\202"},
+		{"LessTilde", "\342\211\262"},
+		{"parsl", "\342\253\275"},
+		{NULL, NULL},
+		{"nscr", "\360\235\223\203"},
+		{NULL, NULL},
+		{"Xi", "\316\236"},
+		{NULL, NULL},
+		{"vDash", "\342\212\250"},
+		{"Yfr", "\360\235\224\234"},
+		{NULL, NULL},
+		{"Scedil", "\305\236"},
+		{"NegativeThinSpace", "\342\200\213"},
+		{"Xfr", "\360\235\224\233"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"DownRightVectorBar", "\342\245\227"},
+		{"DownLeftTeeVector", "\342\245\236"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"NotSquareSuperset", "\342\212\220\314\270"},
+		{NULL, NULL},
+		{"les", "\342\251\275"},
+		{"imacr", "\304\253"},
+		{"bsolb", "\342\247\205"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"prsim", "\342\211\276"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"dharl", "\342\207\203"},
+		{NULL, NULL},
+		{"frac45", "\342\205\230"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"mDDot", "\342\210\272"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"icirc", "\303\256"},
+		{"divonx", "\342\213\207"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"upsih", "\317\222"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rangd", "\342\246\222"},
+		{"laemptyv", "\342\246\264"},
+		{"sccue", "\342\211\275"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"TSHcy", "\320\213"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"LeftRightVector", "\342\245\216"},
+		{"angmsdaf", "\342\246\255"},
+		{"cuvee", "\342\213\216"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"andslope", "\342\251\230"},
+		{"forall", "\342\210\200"},
+		{"euml", "\303\253"},
+		{"ntriangleleft", "\342\213\252"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"vert", "\174"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"plusb", "\342\212\236"},
+		{NULL, NULL},
+		{"lvertneqq", "\342\211\250\357\270\200"},
+		{"rightrightarrows", "\342\207\211"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"xnis", "\342\213\273"},
+		{NULL, NULL},
+		{"ngeqslant", "\342\251\276\314\270"},
+		{"bullet", "\342\200\242"},
+		{NULL, NULL},
+		{"notinvb", "\342\213\267"},
+		{"iexcl", "\302\241"},
+		{NULL, NULL},
+		{"Vfr", "\360\235\224\231"},
+		{"DiacriticalDoubleAcute", "\313\235"},
+		{NULL, NULL},
+		{"utri", "\342\226\265"},
+		{"Iukcy", "\320\206"},
+		{"frac38", "\342\205\234"},
+		{NULL, NULL},
+		{"Icy", "\320\230"},
+		{"boxvr", "\342\224\234"},
+		{"rceil", "\342\214\211"},
+		{NULL, NULL},
+		{"itilde", "\304\251"},
+		{NULL, NULL},
+		{"epar", "\342\213\225"},
+		{"harrcir", "\342\245\210"},
+		{"tfr", "\360\235\224\261"},
+		{NULL, NULL},
+		{"ncong", "\342\211\207"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"succneqq", "\342\252\266"},
+		{"cfr", "\360\235\224\240"},
+		{NULL, NULL},
+		{"epsiv", "\317\265"},
+		{"Subset", "\342\213\220"},
+		{NULL, NULL},
+		{"Bopf", "\360\235\224\271"},
+		{NULL, NULL},
+		{"female", "\342\231\200"},
+		{"lambda", "\316\273"},
+		{"phmmat", "\342\204\263"},
+		{"roplus", "\342\250\256"},
+		{NULL, NULL},
+		{"infintie", "\342\247\235"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"geqslant", "\342\251\276"},
+		{NULL, NULL},
+		{"rarrap", "\342\245\265"},
+		{NULL, NULL},
+		{"breve", "\313\230"},
+		{"it", "\342\201\242"},
+		{"boxVl", "\342\225\242"},
+		{"eDDot", "\342\251\267"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"eqvparsl", "\342\247\245"},
+		{NULL, NULL},
+		{"NotTildeEqual", "\342\211\204"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"epsi", "\316\265"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"larrfs", "\342\244\235"},
+		{NULL, NULL},
+		{"ecaron", "\304\233"},
+		{NULL, NULL},
+		{"leg", "\342\213\232"},
+		{"ord", "\342\251\235"},
+		{"bigcap", "\342\213\202"},
+		{"rfloor", "\342\214\213"},
+		{NULL, NULL},
+		{"sstarf", "\342\213\206"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"bkarow", "\342\244\215"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Ofr", "\360\235\224\222"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"yfr", "\360\235\224\266"},
+		{NULL, NULL},
+		{"Vopf", "\360\235\225\215"},
+		{NULL, NULL},
+		{"Oopf", "\360\235\225\206"},
+		{"lhblk", "\342\226\204"},
+		{"omid", "\342\246\266"},
+		{NULL, NULL},
+		{"fnof", "\306\222"},
+		{"NotGreaterLess", "\342\211\271"},
+		{"rtriltri", "\342\247\216"},
+		{NULL, NULL},
+		{"topcir", "\342\253\261"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ldquor", "\342\200\236"},
+		{"equiv", "\342\211\241"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Efr", "\360\235\224\210"},
+		{"lsimg", "\342\252\217"},
+		{"rtrif", "\342\226\270"},
+		{NULL, NULL},
+		{"NegativeMediumSpace", "\342\200\213"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Upsi", "\317\222"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Eacute", "\303\211"},
+		{"profline", "\342\214\222"},
+		{"swarhk", "\342\244\246"},
+		{"nVDash", "\342\212\257"},
+		{"intprod", "\342\250\274"},
+		{"epsilon", "\316\265"},
+		{NULL, NULL},
+		{"SquareIntersection", "\342\212\223"},
+		{"dHar", "\342\245\245"},
+		{"Gcedil", "\304\242"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Zcaron", "\305\275"},
+		{NULL, NULL},
+		{"thetasym", "\317\221"},
+		{NULL, NULL},
+		{"doteq", "\342\211\220"},
+		{"ffllig", "\357\254\204"},
+		{"rscr", "\360\235\223\207"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"downarrow", "\342\206\223"},
+		{"nparallel", "\342\210\246"},
+		{"Pr", "\342\252\273"},
+		{NULL, NULL},
+		{"ascr", "\360\235\222\266"},
+		{"lesges", "\342\252\223"},
+		{NULL, NULL},
+		{"vartriangleleft", "\342\212\262"},
+		{NULL, NULL},
+		{"ngeq", "\342\211\261"},
+		{NULL, NULL},
+		{"leftarrow", "\342\206\220"},
+		{"khcy", "\321\205"},
+		{NULL, NULL},
+		{"Mopf", "\360\235\225\204"},
+		{NULL, NULL},
+		{"sup2", "\302\262"},
+		{"LT", "\074"},
+		{NULL, NULL},
+		{"Precedes", "\342\211\272"},
+		{NULL, NULL},
+		{"LeftArrow", "\342\206\220"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"wopf", "\360\235\225\250"},
+		{"gesles", "\342\252\224"},
+		{"ljcy", "\321\231"},
+		{"Jsercy", "\320\210"},
+		{NULL, NULL},
+		{"cirE", "\342\247\203"},
+		{"capand", "\342\251\204"},
+		{"crarr", "\342\206\265"},
+		{"Abreve", "\304\202"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"frac23", "\342\205\224"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"sscr", "\360\235\223\210"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nrightarrow", "\342\206\233"},
+		{"varkappa", "\317\260"},
+		{"Omega", "\316\251"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"hscr", "\360\235\222\275"},
+		{"notniva", "\342\210\214"},
+		{"nlsim", "\342\211\264"},
+		{NULL, NULL},
+		{"VDash", "\342\212\253"},
+		{NULL, NULL},
+		{"boxHd", "\342\225\244"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"mopf", "\360\235\225\236"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"FilledVerySmallSquare", "\342\226\252"},
+		{"Downarrow", "\342\207\223"},
+		{"loarr", "\342\207\275"},
+		{"scap", "\342\252\270"},
+		{"check", "\342\234\223"},
+		{"prnsim", "\342\213\250"},
+		{NULL, NULL},
+		{"shcy", "\321\210"},
+		{"parsim", "\342\253\263"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"VerticalBar", "\342\210\243"},
+		{NULL, NULL},
+		{"vnsub", "\342\212\202\342\203\222"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ccirc", "\304\211"},
+		{NULL, NULL},
+		{"sqcaps", "\342\212\223\357\270\200"},
+		{NULL, NULL},
+		{"Scy", "\320\241"},
+		{NULL, NULL},
+		{"Sqrt", "\342\210\232"},
+		{"DJcy", "\320\202"},
+		{NULL, NULL},
+		{"ropf", "\360\235\225\243"},
+		{"minusdu", "\342\250\252"},
+		{NULL, NULL},
+		{"subnE", "\342\253\213"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"fallingdotseq", "\342\211\222"},
+		{"nfr", "\360\235\224\253"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"kappav", "\317\260"},
+		{NULL, NULL},
+		{"timesbar", "\342\250\261"},
+		{"hoarr", "\342\207\277"},
+		{NULL, NULL},
+		{"multimap", "\342\212\270"},
+		{"ETH", "\303\220"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nsce", "\342\252\260\314\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"emsp", "\342\200\203"},
+		{"iecy", "\320\265"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"smeparsl", "\342\247\244"},
+		{NULL, NULL},
+		{"sect", "\302\247"},
+		{"sqsup", "\342\212\220"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"RightUpDownVector", "\342\245\217"},
+		{NULL, NULL},
+		{"Rarr", "\342\206\240"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ltcc", "\342\252\246"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lgE", "\342\252\221"},
+		{NULL, NULL},
+		{"gsiml", "\342\252\220"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"preccurlyeq", "\342\211\274"},
+		{NULL, NULL},
+		{"nshortmid", "\342\210\244"},
+		{"egrave", "\303\250"},
+		{"vBarv", "\342\253\251"},
+		{NULL, NULL},
+		{"Ifr", "\342\204\221"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Bumpeq", "\342\211\216"},
+		{"deg", "\302\260"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Ntilde", "\303\221"},
+		{"ImaginaryI", "\342\205\210"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"LeftAngleBracket", "\342\237\250"},
+		{"rdquo", "\342\200\235"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lopf", "\360\235\225\235"},
+		{NULL, NULL},
+		{"sum", "\342\210\221"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ic", "\342\201\243"},
+		{"srarr", "\342\206\222"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Xopf", "\360\235\225\217"},
+		{NULL, NULL},
+		{"part", "\342\210\202"},
+		{"yucy", "\321\216"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"scedil", "\305\237"},
+		{"Map", "\342\244\205"},
+		{"CloseCurlyDoubleQuote", "\342\200\235"},
+		{"boxVR", "\342\225\240"},
+		{NULL, NULL},
+		{"SquareSubsetEqual", "\342\212\221"},
+		{NULL, NULL},
+		{"comma", "\054"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"veeeq", "\342\211\232"},
+		{"Sopf", "\360\235\225\212"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"sfr", "\360\235\224\260"},
+		{"dagger", "\342\200\240"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Ocy", "\320\236"},
+		{NULL, NULL},
+		{"chcy", "\321\207"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"vartriangleright", "\342\212\263"},
+		{"precneqq", "\342\252\265"},
+		{NULL, NULL},
+		{"boxdL", "\342\225\225"},
+		{"nle", "\342\211\260"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ldrushar", "\342\245\213"},
+		{NULL, NULL},
+		{"ltimes", "\342\213\211"},
+		{NULL, NULL},
+		{"cup", "\342\210\252"},
+		{"jsercy", "\321\230"},
+		{NULL, NULL},
+		{"sopf", "\360\235\225\244"},
+		{NULL, NULL},
+		{"qscr", "\360\235\223\206"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"DiacriticalAcute", "\302\264"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"brvbar", "\302\246"},
+		{NULL, NULL},
+		{"frac13", "\342\205\223"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"LeftDownVectorBar", "\342\245\231"},
+		{NULL, NULL},
+		{"Wedge", "\342\213\200"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"NotGreaterFullEqual", "\342\211\247\314\270"},
+		{"eqcirc", "\342\211\226"},
+		{"NotRightTriangleBar", "\342\247\220\314\270"},
+		{"boxVH", "\342\225\254"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"supe", "\342\212\207"},
+		{"capcup", "\342\251\207"},
+		{"Colon", "\342\210\267"},
+		{"delta", "\316\264"},
+		{"DoubleLeftRightArrow", "\342\207\224"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Gbreve", "\304\236"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"bcy", "\320\261"},
+		{NULL, NULL},
+		{"Ll", "\342\213\230"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"bigotimes", "\342\250\202"},
+		{NULL, NULL},
+		{"cupcap", "\342\251\206"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"male", "\342\231\202"},
+		{"malt", "\342\234\240"},
+		{NULL, NULL},
+		{"xuplus", "\342\250\204"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lpar", "\050"},
+		{"kcy", "\320\272"},
+		{NULL, NULL},
+		{"UnderBrace", "\342\217\237"},
+		{"macr", "\302\257"},
+		{"gnE", "\342\211\251"},
+		{NULL, NULL},
+		{"Tilde", "\342\210\274"},
+		{"SOFTcy", "\320\254"},
+		{"setminus", "\342\210\226"},
+		{NULL, NULL},
+		{"LeftCeiling", "\342\214\210"},
+		{"intcal", "\342\212\272"},
+		{"precapprox", "\342\252\267"},
+		{"gtcc", "\342\252\247"},
+		{"ExponentialE", "\342\205\207"},
+		{"plussim", "\342\250\246"},
+		{"lparlt", "\342\246\223"},
+		{NULL, NULL},
+		{"boxhU", "\342\225\250"},
+		{NULL, NULL},
+		{"CircleMinus", "\342\212\226"},
+		{NULL, NULL},
+		{"zhcy", "\320\266"},
+		{NULL, NULL},
+		{"numero", "\342\204\226"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"dsol", "\342\247\266"},
+		{"Colone", "\342\251\264"},
+		{"odash", "\342\212\235"},
+		{NULL, NULL},
+		{"rhard", "\342\207\201"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Uopf", "\360\235\225\214"},
+		{NULL, NULL},
+		{"VerticalSeparator", "\342\235\230"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"uarr", "\342\206\221"},
+		{NULL, NULL},
+		{"lmidot", "\305\200"},
+		{"spar", "\342\210\245"},
+		{"ee", "\342\205\207"},
+		{"subsup", "\342\253\223"},
+		{"scaron", "\305\241"},
+		{"tritime", "\342\250\273"},
+		{"swnwar", "\342\244\252"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nexists", "\342\210\204"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Otilde", "\303\225"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Esim", "\342\251\263"},
+		{"roarr", "\342\207\276"},
+		{"oacute", "\303\263"},
+		{NULL, NULL},
+		{"Dagger", "\342\200\241"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"apE", "\342\251\260"},
+		{"GJcy", "\320\203"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"RightTriangleBar", "\342\247\220"},
+		{NULL, NULL},
+		{"nisd", "\342\213\272"},
+		{"NotTilde", "\342\211\201"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lozf", "\342\247\253"},
+		{"luruhar", "\342\245\246"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"jcirc", "\304\265"},
+		{NULL, NULL},
+		{"bowtie", "\342\213\210"},
+		{"Iota", "\316\231"},
+		{"nLtv", "\342\211\252\314\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"neArr", "\342\207\227"},
+		{"boxUl", "\342\225\234"},
+		{NULL, NULL},
+		{"nleq", "\342\211\260"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"seswar", "\342\244\251"},
+		{NULL, NULL},
+		{"lnapprox", "\342\252\211"},
+		{"harr", "\342\206\224"},
+		{NULL, NULL},
+		{"lbrke", "\342\246\213"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"vee", "\342\210\250"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nvlArr", "\342\244\202"},
+		{NULL, NULL},
+		{"reals", "\342\204\235"},
+		{NULL, NULL},
+		{"prnE", "\342\252\265"},
+		{"RightTee", "\342\212\242"},
+		{"Eopf", "\360\235\224\274"},
+		{"edot", "\304\227"},
+		{NULL, NULL},
+		{"simlE", "\342\252\237"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"cacute", "\304\207"},
+		{NULL, NULL},
+		{"ngeqq", "\342\211\247\314\270"},
+		{"frac25", "\342\205\226"},
+		{"OverBracket", "\342\216\264"},
+		{"Im", "\342\204\221"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"plusdo", "\342\210\224"},
+		{"Hat", "\136"},
+		{"pscr", "\360\235\223\205"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nsucceq", "\342\252\260\314\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"utrif", "\342\226\264"},
+		{"Lstrok", "\305\201"},
+		{"sacute", "\305\233"},
+		{"frasl", "\342\201\204"},
+		{"gel", "\342\213\233"},
+		{"Yacute", "\303\235"},
+		{NULL, NULL},
+		{"suphsub", "\342\253\227"},
+		{"boxVh", "\342\225\253"},
+		{"GreaterEqualLess", "\342\213\233"},
+		{"gtreqless", "\342\213\233"},
+		{"orslope", "\342\251\227"},
+		{"LeftTeeVector", "\342\245\232"},
+		{"topf", "\360\235\225\245"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"GreaterGreater", "\342\252\242"},
+		{"Alpha", "\316\221"},
+		{"npar", "\342\210\246"},
+		{"gesl", "\342\213\233\357\270\200"},
+		{"ogon", "\313\233"},
+		{"nLeftrightarrow", "\342\207\216"},
+		{"ReverseUpEquilibrium", "\342\245\257"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"tbrk", "\342\216\264"},
+		{NULL, NULL},
+		{"ll", "\342\211\252"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nvdash", "\342\212\254"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Lscr", "\342\204\222"},
+		{"otilde", "\303\265"},
+		{NULL, NULL},
+		{"boxHD", "\342\225\246"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"olarr", "\342\206\272"},
+		{"angmsdae", "\342\246\254"},
+		{"Imacr", "\304\252"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"lrm", "\342\200\216"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"grave", "\140"},
+		{"nLeftarrow", "\342\207\215"},
+		{"LessGreater", "\342\211\266"},
+		{NULL, NULL},
+		{"nlt", "\342\211\256"},
+		{"gvnE", "\342\211\251\357\270\200"},
+		{"scE", "\342\252\264"},
+		{"eqslantgtr", "\342\252\226"},
+		{NULL, NULL},
+		{"micro", "\302\265"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"curarr", "\342\206\267"},
+		{NULL, NULL},
+		{"hybull", "\342\201\203"},
+		{"Uarrocir", "\342\245\211"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Omicron", "\316\237"},
+		{NULL, NULL},
+		{"scsim", "\342\211\277"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"niv", "\342\210\213"},
+		{"upuparrows", "\342\207\210"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"gesdot", "\342\252\200"},
+		{"erarr", "\342\245\261"},
+		{"ifr", "\360\235\224\246"},
+		{"xcirc", "\342\227\257"},
+		{NULL, NULL},
+		{"LowerLeftArrow", "\342\206\231"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Upsilon", "\316\245"},
+		{"blacktriangle", "\342\226\264"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"DotEqual", "\342\211\220"},
+		{"emsp14", "\342\200\205"},
+		{NULL, NULL},
+		{"slarr", "\342\206\220"},
+		{NULL, NULL},
+		{"lesseqgtr", "\342\213\232"},
+		{"varsupsetneqq", "\342\253\214\357\270\200"},
+		{"lltri", "\342\227\272"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"tshcy", "\321\233"},
+		{"vangrt", "\342\246\234"},
+		{NULL, NULL},
+		{"fopf", "\360\235\225\227"},
+		{"udblac", "\305\261"},
+		{NULL, NULL},
+		{"scnsim", "\342\213\251"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"And", "\342\251\223"},
+		{"preceq", "\342\252\257"},
+		{"Udblac", "\305\260"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"fflig", "\357\254\200"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"sdote", "\342\251\246"},
+		{NULL, NULL},
+		{"vellip", "\342\213\256"},
+		{"SuchThat", "\342\210\213"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Ncy", "\320\235"},
+		{NULL, NULL},
+		{"acy", "\320\260"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"duhar", "\342\245\257"},
+		{NULL, NULL},
+		{"bsemi", "\342\201\217"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nrarr", "\342\206\233"},
+		{"iiota", "\342\204\251"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"simgE", "\342\252\240"},
+		{"ograve", "\303\262"},
+		{NULL, NULL},
+		{"mlcp", "\342\253\233"},
+		{"NotReverseElement", "\342\210\214"},
+		{NULL, NULL},
+		{"nlArr", "\342\207\215"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Zeta", "\316\226"},
+		{"kgreen", "\304\270"},
+		{NULL, NULL},
+		{"zopf", "\360\235\225\253"},
+		{"SquareUnion", "\342\212\224"},
+		{NULL, NULL},
+		{"yacy", "\321\217"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"cupdot", "\342\212\215"},
+		{"Pscr", "\360\235\222\253"},
+		{"hercon", "\342\212\271"},
+		{NULL, NULL},
+		{"lrcorner", "\342\214\237"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"iprod", "\342\250\274"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"parallel", "\342\210\245"},
+		{"rpar", "\051"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"HARDcy", "\320\252"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"angmsdad", "\342\246\253"},
+		{"Hcirc", "\304\244"},
+		{NULL, NULL},
+		{"Element", "\342\210\210"},
+		{"boxtimes", "\342\212\240"},
+		{"Verbar", "\342\200\226"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"boxvL", "\342\225\241"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"frac56", "\342\205\232"},
+		{"RightDoubleBracket", "\342\237\247"},
+		{"NotPrecedes", "\342\212\200"},
+		{"els", "\342\252\225"},
+		{NULL, NULL},
+		{"emacr", "\304\223"},
+		{NULL, NULL},
+		{"Rcy", "\320\240"},
+		{NULL, NULL},
+		{"timesb", "\342\212\240"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"boxplus", "\342\212\236"},
+		{"Rho", "\316\241"},
+		{"LeftRightArrow", "\342\206\224"},
+		{"NotElement", "\342\210\211"},
+		{"Theta", "\316\230"},
+		{"Agrave", "\303\200"},
+		{"straightepsilon", "\317\265"},
+		{NULL, NULL},
+		{"hfr", "\360\235\224\245"},
+		{"LeftArrowRightArrow", "\342\207\206"},
+		{"nsubE", "\342\253\205\314\270"},
+		{"kappa", "\316\272"},
+		{"sharp", "\342\231\257"},
+		{"robrk", "\342\237\247"},
+		{NULL, NULL},
+		{"half", "\302\275"},
+		{"Dcy", "\320\224"},
+		{"biguplus", "\342\250\204"},
+		{NULL, NULL},
+		{"larrbfs", "\342\244\237"},
+		{NULL, NULL},
+		{"sube", "\342\212\206"},
+		{"subsetneq", "\342\212\212"},
+		{"smid", "\342\210\243"},
+		{"pcy", "\320\277"},
+		{NULL, NULL},
+		{"zigrarr", "\342\207\235"},
+		{"lowbar", "\137"},
+		{"CenterDot", "\302\267"},
+		{"beth", "\342\204\266"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"imagline", "\342\204\220"},
+		{"bprime", "\342\200\265"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"varnothing", "\342\210\205"},
+		{"Hopf", "\342\204\215"},
+		{"ofcir", "\342\246\277"},
+		{"Rscr", "\342\204\233"},
+		{"TildeFullEqual", "\342\211\205"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rsh", "\342\206\261"},
+		{NULL, NULL},
+		{"CirclePlus", "\342\212\225"},
+		{"gE", "\342\211\247"},
+		{NULL, NULL},
+		{"elinters", "\342\217\247"},
+		{NULL, NULL},
+		{"dash", "\342\200\220"},
+		{"frac58", "\342\205\235"},
+		{"coloneq", "\342\211\224"},
+		{"bump", "\342\211\216"},
+		{NULL, NULL},
+		{"loz", "\342\227\212"},
+		{"fllig", "\357\254\202"},
+		{NULL, NULL},
+		{"therefore", "\342\210\264"},
+		{"supsub", "\342\253\224"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"asympeq", "\342\211\215"},
+		{"olcross", "\342\246\273"},
+		{"CircleTimes", "\342\212\227"},
+		{"planckh", "\342\204\216"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"efDot", "\342\211\222"},
+		{"Bfr", "\360\235\224\205"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rarrc", "\342\244\263"},
+		{"Assign", "\342\211\224"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Idot", "\304\260"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"rcaron", "\305\231"},
+		{NULL, NULL},
+		{"iocy", "\321\221"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"incare", "\342\204\205"},
+		{NULL, NULL},
+		{"UnderBar", "\137"},
+		{"supdsub", "\342\253\230"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ocirc", "\303\264"},
+		{NULL, NULL},
+		{"caps", "\342\210\251\357\270\200"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"demptyv", "\342\246\261"},
+		{NULL, NULL},
+		{"xrarr", "\342\237\266"},
+		{"subE", "\342\253\205"},
+		{"nabla", "\342\210\207"},
+		{"xdtri", "\342\226\275"},
+		{NULL, NULL},
+		{"dotsquare", "\342\212\241"},
+		{NULL, NULL},
+		{"dtri", "\342\226\277"},
+		{NULL, NULL},
+		{"Laplacetrf", "\342\204\222"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Proportional", "\342\210\235"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Ropf", "\342\204\235"},
+		{"Xscr", "\360\235\222\263"},
+		{NULL, NULL},
+		{"rbrksld", "\342\246\216"},
+		{NULL, NULL},
+		{"lozenge", "\342\227\212"},
+		{"ratio", "\342\210\266"},
+		{"acute", "\302\264"},
+		{"qfr", "\360\235\224\256"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Zcy", "\320\227"},
+		{NULL, NULL},
+		{"NotEqualTilde", "\342\211\202\314\270"},
+		{NULL, NULL},
+		{"downdownarrows", "\342\207\212"},
+		{"GreaterEqual", "\342\211\245"},
+		{NULL, NULL},
+		{"backsimeq", "\342\213\215"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"UpArrow", "\342\206\221"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"Rightarrow", "\342\207\222"},
+		{"nge", "\342\211\261"},
+		{"wedge", "\342\210\247"},
+		{"Fscr", "\342\204\261"},
+		{"DoubleUpArrow", "\342\207\221"},
+		{"nsupseteqq", "\342\253\206\314\270"},
+		{NULL, NULL},
+		{"cdot", "\304\213"},
+		{"nvgt", "\076\342\203\222"},
+		{"angsph", "\342\210\242"},
+		{NULL, NULL},
+		{"spades", "\342\231\240"},
+		{NULL, NULL},
+		{"Leftarrow", "\342\207\220"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"nlE", "\342\211\246\314\270"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"varsubsetneqq", "\342\253\213\357\270\200"},
+		{"frac18", "\342\205\233"},
+		{"AElig", "\303\206"},
+		{NULL, NULL},
+		{"amacr", "\304\201"},
+		{"Mellintrf", "\342\204\263"},
+		{"gt", "\076"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ncup", "\342\251\202"},
+		{"Fopf", "\360\235\224\275"},
+		{NULL, NULL},
+		{"qint", "\342\250\214"},
+		{"Product", "\342\210\217"},
+		{"rsqb", "\135"},
+		{"lbarr", "\342\244\214"},
+		{"LeftVectorBar", "\342\245\222"},
+		{"auml", "\303\244"},
+		{"apacir", "\342\251\257"},
+		{"TildeTilde", "\342\211\210"},
+		{"jscr", "\360\235\222\277"},
+		{NULL, NULL},
+		{"lfr", "\360\235\224\251"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"twoheadleftarrow", "\342\206\236"},
+		{"Ucirc", "\303\233"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"succ", "\342\211\273"},
+		{"supE", "\342\253\206"},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{NULL, NULL},
+		{"ruluhar", "\342\245\250"},
+		{"rsaquo", "\342\200\272"},
+		{NULL, NULL},
+		{"nles", "\342\251\275\314\270"},
+		{NULL, NULL},
+		{"ltrPar", "\342\246\226"},
+		{"minusd", "\342\210\270"},
+		{NULL, NULL},
+		{"LeftFloor", "\342\214\212"},
+		{"nesear", "\342\244\250"},
+		{"curvearrowleft", "\342\206\266"}
+	};
+}
+
+//Returns the UTF-8 value of the named entity, or NULL if the name is not an entity
+//name is not null-terminated and does not include '&' and ';'
+const char* HtmlEntities::Lookup(const char* name, int length)
+{
+	if(length <= 0 || length > maxNameLength) return NULL;
+
+	unsigned int bucket = EntityHash(name, length, 0) % numBuckets;
+	const HtmlEntity& entity = slots[EntityHash(name, length, displacements[bucket]) % numSlots];
+
+	if(entity.name == NULL) return NULL;
+	if(strncmp(entity.name, name, length) != 0 || entity.name[length] != 0) return NULL;
+	return entity.value;
+}
@@ -0,0 +1,205 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#include "MappedArchive.h"
+#include <cstring>
+
+static const char mappedArchiveMagic[8] = {'D','Z','M','A','P','A','R','C'};
+
+CMappedArchive::CMappedArchive():
+	data(NULL),
+	size(0),
+	position(0),
+	fStoring(false),
+	fFailed(false)
+{
+}
+
+CMappedArchive::~CMappedArchive()
+{
+	Close();
+}
+
+bool CMappedArchive::OpenForSaving(const BString& fileName, int contentVersion)
+{
+	Close();
+
+	fStoring = true;
+	fFailed = false;
+	outStream.open(fileName, std::ios::binary);
+	if(!outStream)
+	{
+		std::cerr << "Could not open file for writing: " << fileName << ".\n";
+		fFailed = true;
+		return false;
+	}
+
+	int versions[2] = {formatVersion, contentVersion};
+	outStream.write(mappedArchiveMagic, sizeof(mappedArchiveMagic));
+	outStream.write((const char*)versions, sizeof(versions));
+
+	return true;
+}
+
+bool CMappedArchive::OpenForLoading(const BString& fileName, int contentVersion)
+{
+	Close();
+
+	fStoring = false;
+	fFailed = false;
+	if(!file.Open(fileName, true, true))
+	{
+		std::cerr << "Could not open file for reading: " << fileName << ".\n";
+		fFailed = true;
+		return false;
+	}
+
+	size = file.Size();
+	data = file.CopyOnWriteData();
+
+	//Could not be mapped - read the whole file
+	if(data == NULL)
+	{
+		fileCopy.ResizeArray(size,true);
+		if(size > 0 && !file.Read(0, size, fileCopy.arr)) {fFailed = true; return false;}
+		data = fileCopy.arr;
+		file.Close();
+	}
+
+	int versions[2] = {0,0};
+	if(size < 16 || memcmp(data, mappedArchiveMagic, sizeof(mappedArchiveMagic)) != 0) fFailed = true;
+	else memcpy(versions, data + 8, sizeof(versions));
+
+	if(fFailed || versions[0] != formatVersion || versions[1] != contentVersion)
+	{
+		std::cerr << "Unsupported file format: " << fileName << ".\n";
+		fFailed = true;
+		return false;
+	}
+
+	position = 16;
+	return true;
+}
+
+//Saving: closes the file. Loading: empties the arrays that view the file and releases the mapping
+bool CMappedArchive::Close()
+{
+	if(outStream.is_open())
+	{
+		outStream.close();
+		if(!outStream) fFailed = true;
+	}
+
+	for(size_t i=0; i < releaseViews.size(); i++) releaseViews[i]();
+	releaseViews.clear();
+
+	file.Close();
+	fileCopy.ResizeArray(0);
+	data = NULL;
+	size = 0;
+	position = 0;
+
+	return !fFailed;
+}
+
+bool CMappedArchive::IsMappedArchive(const BString& fileName)
+{
+	std::ifstream stream(fileName, std::ios::binary);
+	char magic[sizeof(mappedArchiveMagic)];
+	if(!stream.read(magic, sizeof(magic))) return false;
+
+	return memcmp(magic, mappedArchiveMagic, sizeof(magic)) == 0;
+}
+
+bool CMappedArchive::WriteRecord(const void* elements, int64 count, int64 elemSize)
+{
+	if(fFailed) return false;
+
+	int64 recordHeader[2] = {count, elemSize};
+	outStream.write((const char*)recordHeader, sizeof(recordHeader));
+	outStream.write((const char*)elements, count*elemSize);
+
+	int64 padding = (8 - (count*elemSize)%8)%8;
+	outStream.write("\0\0\0\0\0\0\0", padding);
+
+	if(!outStream) fFailed = true;
+	return !fFailed;
+}
+
+char* CMappedArchive::ReadRecord(int64 elemSize, int64& count)
+{
+	count = 0;
+	if(fFailed || data == NULL || position + 16 > size) {fFailed = true; return NULL;}
+
+	int64 recordHeader[2];
+	memcpy(recordHeader, data + position, sizeof(recordHeader));
+
+	int64 numBytes = recordHeader[0]*elemSize;
+	if(recordHeader[0] < 0 || recordHeader[1] != elemSize || position + 16 + numBytes > size) {fFailed = true; return NULL;}
+
+	char* elements = data + position + 16;
+	count = recordHeader[0];
+	position += 16 + numBytes + (8 - numBytes%8)%8;
+
+	return elements;
+}
+
+CMappedArchive& CMappedArchive::operator&(CBidirectionalMap<BString>& map)
+{
+	if(IsStoring())
+	{
+		(*this) & map.wordArr & map.freqArr;
+		return Value(map.fFreq);
+	}
+
+	CHArray<BString> words;
+	CHArray<int> freqs;
+	bool fFreq = false;
+	(*this) & words;
+	LoadView(freqs);
+	Value(fFreq);
+
+	map.fFreq = fFreq;
+	map.Resize(words.Count());
+	for(int i=0; i < words.Count(); i++)
+	{
+		if(fFreq && i < freqs.Count()) map.AddWord(words[i],freqs[i]);
+		else map.AddWord(words[i],1);
+	}
+
+	return *this;
+}
+
+CMappedArchive& CMappedArchive::operator&(CStringHashIndex& index)
+{
+	(*this) & index.slots;
+	return Value(index.numStrings);
+}
+
+CMappedArchive& CMappedArchive::operator&(CStringPool& pool)
+{
+	(*this) & pool.blob & pool.offsets & pool.slots;
+
+	//An empty offset array would make the pool unusable
+	if(IsLoading() && !fFailed && pool.offsets.IsEmpty()) fFailed = true;
+	return *this;
+}
@@ -0,0 +1,184 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "BString.h"
+#include "Array.h"
+#include "CAIStrings.h"
+#include "BidirectionalMap.h"
+#include "MappedFile.h"
+#include "StringHashIndex.h"
+#include "StringPool.h"
+#include <fstream>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+//A versioned file format for containers that is loaded by mapping the file into memory
+//Unlike BArchive, loading does no per-element work: a loaded CHArray of plain data is a virtual array
+//that views the mapped file, so loading takes the time to map the file, whatever its size
+
+//The file is mapped copy-on-write, so loaded arrays can be changed in memory - the file never changes
+//The views are valid as long as the archive is open - keep the archive with the data it has loaded
+//Close() empties the arrays that still view the file, so they do not outlive the mapping - declare the archive
+//after the arrays it loads. An array that is grown after loading copies its elements and stops being a view
+
+//Layout: header, then one record per array, in the order of saving
+//Header:	magic (8 chars), format version (int), content version (int)
+//Record:	number of elements (int64), element size in bytes (int64), elements, padding to 8 bytes
+
+//Like BArchive, one function handles both directions: ar & arr stores arr when saving, and loads it when loading
+//Handles CHArray of plain data, CAIStrings, CHArray<BString>, CBidirectionalMap<BString>,
+//CStringPool, CPooledStringArray and CStringHashIndex
+//Strings are stored as a string table: an int64 offset array and a char blob
+//CHArray<BString> and CBidirectionalMap<BString> still build their strings on loading
+
+class CMappedArchive
+{
+public:
+	CMappedArchive();
+	~CMappedArchive();
+
+	enum {formatVersion = 1};
+
+public:
+	//The content version is chosen by the user of the archive, and is checked on loading
+	bool OpenForSaving(const BString& fileName, int contentVersion);
+	bool OpenForLoading(const BString& fileName, int contentVersion);
+	bool Close();					//Returns false if anything failed while saving or loading
+	static bool IsMappedArchive(const BString& fileName);	//Whether the file starts with the archive header
+
+	bool IsStoring() const {return fStoring;};
+	bool IsLoading() const {return !fStoring;};
+	bool IsOk() const {return !fFailed;};
+
+	template <class theType, class intType> CMappedArchive& operator&(CHArray<theType,intType>& arr);
+	template <class intType> CMappedArchive& operator&(CHArray<BString,intType>& arr);
+	template <class theType, class intType> CMappedArchive& operator&(CAIStrings<theType,intType>& cais);
+	CMappedArchive& operator&(CBidirectionalMap<BString>& map);
+	CMappedArchive& operator&(CStringHashIndex& index);		//Call Attach() on the loaded index
+	CMappedArchive& operator&(CStringPool& pool);
+	CMappedArchive& operator&(CPooledStringArray& arr) {return (*this) & arr.ids;};	//Only the ids - handle the pool separately
+
+	template <class theType> CMappedArchive& Value(theType& val);	//A single value of plain data
+
+private:
+	template <class theType, class intType> void LoadView(CHArray<theType,intType>& arr);	//Not emptied by Close()
+	bool WriteRecord(const void* data, int64 count, int64 elemSize);
+	char* ReadRecord(int64 elemSize, int64& count);		//Pointer to the elements in memory, NULL on failure
+
+	std::ofstream outStream;		//When saving
+	CMappedFile file;				//When loading
+	CHArray<char,int64> fileCopy;	//When loading a file that could not be mapped
+	char* data;
+	int64 size;
+	int64 position;
+	bool fStoring;
+	bool fFailed;
+	std::vector<std::function<void()>> releaseViews;	//Empty the loaded arrays that view the file
+
+	//Not copyable
+	CMappedArchive(const CMappedArchive&);
+	CMappedArchive& operator=(const CMappedArchive&);
+};
+
+template <class theType, class intType>
+CMappedArchive& CMappedArchive::operator&(CHArray<theType,intType>& arr)
+{
+	static_assert(!std::is_class<theType>::value, "CMappedArchive stores arrays of plain data only");
+
+	if(IsStoring())
+	{
+		WriteRecord(arr.arr, arr.Count(), sizeof(theType));
+		return *this;
+	}
+
+	LoadView(arr);
+	if(arr.IsVirtual()) releaseViews.push_back([&arr]{arr.ReleaseVirtual();});
+	return *this;
+}
+
+template <class theType, class intType>
+void CMappedArchive::LoadView(CHArray<theType,intType>& arr)
+{
+	int64 count;
+	theType* elements = (theType*)ReadRecord(sizeof(theType), count);
+
+	//Empty records are loaded as regular arrays
+	if(elements == NULL || count == 0) {arr.ReleaseVirtual(); arr.EraseArray(); return;}
+
+	arr.SetVirtual(elements, (intType)count);
+}
+
+template <class intType>
+CMappedArchive& CMappedArchive::operator&(CHArray<BString,intType>& arr)
+{
+	if(IsStoring())
+	{
+		int64 count = arr.Count();
+		CHArray<int64,int64> offsets(count+1);
+		offsets.AddAndExtend(0);
+		for(intType i=0;i<arr.Count();i++) offsets.AddAndExtend(offsets.Last() + arr[i].GetLength());
+
+		if(!WriteRecord(offsets.arr, offsets.Count(), sizeof(int64))) return *this;
+
+		//The blob record is written string by string, it is not assembled in memory
+		int64 blobHeader[2] = {offsets.Last(), 1};
+		outStream.write((const char*)blobHeader, sizeof(blobHeader));
+		for(intType i=0;i<arr.Count();i++) outStream.write(arr[i].c_str(), arr[i].GetLength());
+		int64 padding = (8 - offsets.Last()%8)%8;
+		outStream.write("\0\0\0\0\0\0\0", padding);
+		if(!outStream) fFailed = true;
+		return *this;
+	}
+
+	int64 numOffsets, blobSize;
+	const int64* offsets = (const int64*)ReadRecord(sizeof(int64), numOffsets);
+	const char* blob = ReadRecord(1, blobSize);
+	if(offsets == NULL || blob == NULL || numOffsets < 1 || offsets[numOffsets-1] != blobSize) {fFailed = true; arr.EraseArray(); return *this;}
+
+	intType count = (intType)(numOffsets - 1);
+	arr.ResizeArray(count,true);
+	for(intType i=0;i<count;i++) arr[i].assign(blob + offsets[i], (size_t)(offsets[i+1] - offsets[i]));
+
+	return *this;
+}
+
+template <class theType, class intType>
+CMappedArchive& CMappedArchive::operator&(CAIStrings<theType,intType>& cais)
+{
+	return (*this) & cais.storageArr & cais.initIndexArr;
+}
+
+template <class theType>
+CMappedArchive& CMappedArchive::Value(theType& val)
+{
+	CHArray<theType,int64> arr(&val, 1, true);		//Virtual array of one value
+	if(IsStoring()) return (*this) & arr;
+
+	LoadView(arr);
+	if(arr.Count() == 1) val = arr[0];
+	else fFailed = true;
+
+	return *this;
+}
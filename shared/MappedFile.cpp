@@ -0,0 +1,221 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#include "MappedFile.h"
+#include <cstring>
+#include <stdint.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+CMappedFile::CMappedFile():
+	#ifdef _WIN32
+		fileHandle(INVALID_HANDLE_VALUE),
+		mappingHandle(NULL),
+	#else
+		fd(-1),
+	#endif
+	data(NULL),
+	size(0),
+	fCopyOnWrite(false)
+{
+}
+
+CMappedFile::~CMappedFile()
+{
+	Close();
+}
+
+#ifdef _WIN32
+
+bool CMappedFile::Open(const BString& fileName, bool fMap/*=true*/, bool theCopyOnWrite/*=false*/)
+{
+	Close();
+
+	fileHandle = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if(fileHandle == INVALID_HANDLE_VALUE) return false;
+
+	LARGE_INTEGER fileSize;
+	if(!GetFileSizeEx(fileHandle, &fileSize)) {Close(); return false;}
+	size = fileSize.QuadPart;
+
+	//Mapping can fail for large files in a 32-bit process - Read() falls back to positional reads then
+	//Files larger than the address space are not mapped at all, the size would not fit in size_t
+	if(!fMap || size == 0 || (uint64)size > (uint64)SIZE_MAX) return true;
+
+	mappingHandle = CreateFileMappingA(fileHandle, NULL, theCopyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, NULL);
+	if(mappingHandle == NULL) return true;
+
+	data = (const char*)MapViewOfFile(mappingHandle, theCopyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+	if(data == NULL) {CloseHandle(mappingHandle); mappingHandle = NULL;}
+	else fCopyOnWrite = theCopyOnWrite;
+
+	return true;
+}
+
+void CMappedFile::Close()
+{
+	if(data != NULL) UnmapViewOfFile(data);
+	if(mappingHandle != NULL) CloseHandle(mappingHandle);
+	if(fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+
+	data = NULL;
+	mappingHandle = NULL;
+	fileHandle = INVALID_HANDLE_VALUE;
+	size = 0;
+	fCopyOnWrite = false;
+}
+
+bool CMappedFile::IsOpen() const
+{
+	return fileHandle != INVALID_HANDLE_VALUE;
+}
+
+bool CMappedFile::Read(int64 offset, int64 numBytes, void* dest) const
+{
+	if(offset < 0 || numBytes < 0 || offset + numBytes > size) return false;
+
+	if(data != NULL)
+	{
+		memcpy(dest, data + offset, (size_t)numBytes);
+		return true;
+	}
+
+	if(!IsOpen()) return false;
+
+	//ReadFile at an explicit offset - the reads of different threads do not interfere
+	char* cur = (char*)dest;
+	while(numBytes > 0)
+	{
+		DWORD chunk = (numBytes > 0x40000000) ? 0x40000000 : (DWORD)numBytes;
+		OVERLAPPED overlapped;
+		memset(&overlapped, 0, sizeof(overlapped));
+		overlapped.Offset = (DWORD)(offset & 0xFFFFFFFF);
+		overlapped.OffsetHigh = (DWORD)(offset >> 32);
+
+		DWORD numRead = 0;
+		if(!ReadFile(fileHandle, cur, chunk, &numRead, &overlapped) || numRead == 0) return false;
+
+		cur += numRead;
+		offset += numRead;
+		numBytes -= numRead;
+	}
+
+	return true;
+}
+
+void CMappedFile::Advise(AccessPattern /*pattern*/) const
+{
+	//No access hints for file mappings on Windows
+}
+
+#else
+
+bool CMappedFile::Open(const BString& fileName, bool fMap/*=true*/, bool theCopyOnWrite/*=false*/)
+{
+	Close();
+
+	fd = open(fileName, O_RDONLY);
+	if(fd == -1) return false;
+
+	struct stat fileStat;
+	if(fstat(fd, &fileStat) != 0) {Close(); return false;}
+	size = fileStat.st_size;
+
+	//Mapping can fail, e.g. for large files in a 32-bit process - Read() falls back to pread() then
+	//Files larger than the address space are not mapped at all, the size would not fit in size_t
+	if(!fMap || size == 0 || (uint64)size > (uint64)SIZE_MAX) return true;
+
+	void* mapped;
+	if(theCopyOnWrite) mapped = mmap(NULL, (size_t)size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	else mapped = mmap(NULL, (size_t)size, PROT_READ, MAP_SHARED, fd, 0);
+
+	if(mapped != MAP_FAILED)
+	{
+		data = (const char*)mapped;
+		fCopyOnWrite = theCopyOnWrite;
+	}
+
+	return true;
+}
+
+void CMappedFile::Close()
+{
+	if(data != NULL) munmap((void*)data, (size_t)size);
+	if(fd != -1) close(fd);
+
+	data = NULL;
+	fd = -1;
+	size = 0;
+	fCopyOnWrite = false;
+}
+
+bool CMappedFile::IsOpen() const
+{
+	return fd != -1;
+}
+
+bool CMappedFile::Read(int64 offset, int64 numBytes, void* dest) const
+{
+	if(offset < 0 || numBytes < 0 || offset + numBytes > size) return false;
+
+	if(data != NULL)
+	{
+		memcpy(dest, data + offset, (size_t)numBytes);
+		return true;
+	}
+
+	if(!IsOpen()) return false;
+
+	//pread() does not use the file position - the reads of different threads do not interfere
+	char* cur = (char*)dest;
+	while(numBytes > 0)
+	{
+		ssize_t numRead = pread(fd, cur, (size_t)numBytes, (off_t)offset);
+		if(numRead <= 0) return false;
+
+		cur += numRead;
+		offset += numRead;
+		numBytes -= numRead;
+	}
+
+	return true;
+}
+
+void CMappedFile::Advise(AccessPattern pattern) const
+{
+	if(data == NULL) return;
+
+	int advice = MADV_NORMAL;
+	if(pattern == accessSequential) advice = MADV_SEQUENTIAL;
+	if(pattern == accessRandom) advice = MADV_RANDOM;
+
+	madvise((void*)data, (size_t)size, advice);
+}
+
+#endif
@@ -0,0 +1,74 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "BString.h"
+#include "Array.h"
+
+//Read-only access to a file that any number of threads can use at the same time, without locking
+//The file is memory-mapped if possible (mmap, or a file mapping on Windows)
+//Otherwise, or if mapping is not requested, Read() uses positional reads that do not move a shared file position
+
+//With fCopyOnWrite, the mapping is private and writable: writes change only this process's copy, never the file
+
+class CMappedFile
+{
+public:
+	CMappedFile();
+	~CMappedFile();
+
+	enum AccessPattern {accessNormal, accessSequential, accessRandom};
+
+public:
+	bool Open(const BString& fileName, bool fMap = true, bool theCopyOnWrite = false);		//Returns false if the file could not be opened
+	void Close();
+
+	bool IsOpen() const;
+	bool IsMapped() const {return data != NULL;};
+	int64 Size() const {return size;};
+	const char* Data() const {return data;};		//The mapped file, NULL if it is not mapped
+	char* CopyOnWriteData() const {return fCopyOnWrite ? (char*)data : NULL;};	//Writable mapping, NULL if not opened with fCopyOnWrite
+
+	//Copies numBytes at offset into dest, returns false if they could not be read
+	bool Read(int64 offset, int64 numBytes, void* dest) const;
+
+	//Hint to the OS about how the mapped file will be read - sequential scans are read ahead, random reads are not
+	//Does nothing if the file is not mapped or the platform has no such hints
+	void Advise(AccessPattern pattern) const;
+
+private:
+	#ifdef _WIN32
+		void* fileHandle;
+		void* mappingHandle;
+	#else
+		int fd;
+	#endif
+
+	const char* data;
+	int64 size;
+	bool fCopyOnWrite;
+
+	//Not copyable
+	CMappedFile(const CMappedFile&);
+	CMappedFile& operator=(const CMappedFile&);
+};
@@ -30,65 +30,36 @@ using namespace pugi;
 
 namespace pugi
 {
-	/////////////////Extention for pugixml memory writer
-	struct xml_memory_writer: pugi::xml_writer
+	/////////////////Extention for pugixml string writer
+	//Appends the output to a string, so that a node is printed in one pass
+	//The string is not reallocated if it already has the capacity, from previous use
+	struct xml_string_writer: pugi::xml_writer
 	{
-	    char* buffer;
-	    size_t capacity;
-	    size_t result;
-
-	    xml_memory_writer(): buffer(0), capacity(0), result(0){}
-		xml_memory_writer(char* buffer, size_t capacity): buffer(buffer), capacity(capacity), result(0){}
-
-	    size_t written_size() const
-	    {
-	        return result < capacity ? result : capacity;
-	    }
-
-	    virtual void write(const void* data, size_t size)
-	    {
-	        if (result < capacity)
-			{
-				size_t chunk = (capacity - result < size) ? capacity - result : size;
-				memcpy(buffer + result, data, chunk);
-			}
-			result += size;
-		}
-	};
-
-	char* node_to_buffer_heap(pugi::xml_node node, bool fEscapeEntities = false, bool fIndented = false)
-	{
-		unsigned int options;
-		if(fIndented) options = format_indent;
-		else options = format_raw;
-
-		if(!fEscapeEntities) options = options | format_no_escapes;
-
-	    // first pass: get required memory size
-	    xml_memory_writer counter;
-		node.print(counter, "\t" , options);
+		BString& string;
 
-	    // allocate necessary size (+1 for null termination)
-	    char* buffer = new char[counter.result + 1];
+		xml_string_writer(BString& string): string(string){}
 
-	    // second pass: actual printing
-	    xml_memory_writer writer(buffer, counter.result);
-	    node.print(writer, "\t", options);
-
-	    // null terminate
-	    buffer[writer.written_size()] = 0;
-
-	    return buffer;
-	}
-} //////////////End extension for memory writer
+		virtual void write(const void* data, size_t size)
+		{
+			string.append((const char*)data, size);
+		}
+	};
+} //////////////End extension for string writer
 
 
 //Save XML node to the provided string
+//The node is printed once, directly into the string - reusing the same string avoids reallocations
 void SimplestXml::XmlToString(xml_node& node, BString& string, bool fEscapeEntities, bool fIndented)
 {
-	char* heap_buf = node_to_buffer_heap(node, fEscapeEntities, fIndented);
-	string=heap_buf;
-    delete[] heap_buf;
+	unsigned int options;
+	if(fIndented) options = format_indent;
+	else options = format_raw;
+
+	if(!fEscapeEntities) options = options | format_no_escapes;
+
+	string.clear();
+	xml_string_writer writer(string);
+	node.print(writer, "\t", options);
 }
 
 bool SimplestXml::ReadNodeFromFile(const BString& fileName, xml_document& doc)
@@ -112,6 +83,16 @@ xml_parse_result SimplestXml::StringToXml(xml_document& doc, BString& string)
 	return res;
 }
 
+//The document points into buffer, the parser overwrites it
+xml_parse_result SimplestXml::StringToXmlInPlace(xml_document& doc, BString& string, BString& buffer)
+{
+	buffer.swap(string);
+	string.clear();
+
+	if(buffer.empty()) return doc.load_buffer(buffer,0,parse_ws_pcdata);
+	return doc.load_buffer_inplace(&buffer.at(0),buffer.size(),parse_ws_pcdata);
+}
+
 //Copy all child nodes from a node into another XML node
 void SimplestXml::CopyChildrenToNode(xml_node& from, xml_node& to)
 {
@@ -144,6 +125,56 @@ void SimplestXml::InsertChildrenBefore(xml_node& from, xml_node& beforeNode)
 	}
 }
 
+//Move all child nodes from a node into another node of the same document
+void SimplestXml::MoveChildrenToNode(xml_node& from, xml_node& to)
+{
+	xml_node cur=from.first_child();
+	while(cur)
+	{
+		xml_node next=cur.next_sibling();
+		to.append_move(cur);
+		cur=next;
+	}
+}
+
+//Move all child nodes in front of another node of the same document
+void SimplestXml::MoveChildrenBefore(xml_node& from, xml_node& beforeNode)
+{
+	xml_node parent=beforeNode.parent();
+	xml_node cur=from.first_child();
+	while(cur)
+	{
+		xml_node next=cur.next_sibling();
+		parent.insert_move_before(cur,beforeNode);
+		cur=next;
+	}
+}
+
+//Parses the string as XML and appends the resulting nodes to node
+//Same parse options as StringToXml
+//The document keeps a copy of every appended string until it is reset or destroyed,
+//so use it on documents that live for one page or are built once, not on ones that are appended to indefinitely
+xml_node SimplestXml::AppendParsed(xml_node& node, const BString& string)
+{
+	xml_node last=node.last_child();
+	xml_parse_result res=node.append_buffer(string,string.GetLength(),parse_ws_pcdata);
+
+	xml_node first = last ? last.next_sibling() : node.first_child();
+	if(!res)
+	{
+		//Remove whatever was parsed before the error
+		while(first)
+		{
+			xml_node next=first.next_sibling();
+			node.remove_child(first);
+			first=next;
+		}
+		return xml_node();
+	}
+
+	return first;
+}
+
 //Removes all child nodes from a given node
 void SimplestXml::RemoveAllChildren(xml_node& node)
 {
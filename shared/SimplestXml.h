@@ -35,12 +35,26 @@ namespace SimplestXml
 {
 	void XmlToString(xml_node& node, BString& string, bool fEscapeEntities = false, bool fIndented = false);
 	xml_parse_result StringToXml(xml_document& doc, BString& string);
+
+	//Parses without copying the text: string is moved into buffer, and the document is parsed in place in buffer
+	//buffer is owned by the caller and must not be changed or destroyed while the document is in use
+	//string is left empty, with the previous capacity of buffer - it can be reused, e.g. for XmlToString(doc,string)
+	xml_parse_result StringToXmlInPlace(xml_document& doc, BString& string, BString& buffer);
 	bool WriteNodeToFile(const BString& fileName, xml_node& node, bool fEscapeEntities = false, bool fIndented = false);
 	bool ReadNodeFromFile(const BString& fileName, xml_document& doc);
 	
 	void CopyChildrenToNode(xml_node& from, xml_node& to);
 	void CopyChildrenBefore(xml_node& fromNode, xml_node& beforeNode);
 	void InsertChildrenBefore(xml_node& from, xml_node& beforeNode);
+
+	//Moving versions of the above - nodes must be in the same document, nothing is copied
+	void MoveChildrenToNode(xml_node& from, xml_node& to);
+	void MoveChildrenBefore(xml_node& from, xml_node& beforeNode);
+
+	//Parses the string as XML and appends the resulting nodes to node, in the same document
+	//Unlike StringToXml into a separate document, the appended nodes can then be moved into place within that document
+	//Returns the first appended node, or a null node (and appends nothing) on a parse error
+	xml_node AppendParsed(xml_node& node, const BString& string);
 	void RemoveAllChildren(xml_node& node);		//Removes all child nodes from a given node
 	void RemoveAllAttributes(xml_node& node);	//Removes all attributes from a node
 	void RemoveChildrenByName(xml_node& node, const BString& nameString, int& numRemoved);
@@ -0,0 +1,108 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#include "StringHashIndex.h"
+#include <cstring>
+
+//FNV-1a, with a final mix so that the low bits used for the slot depend on all the bytes
+uint64 CStringHashIndex::Hash(const char* string, int64 length)
+{
+	uint64 hash = 14695981039346656037ULL;
+	for(int64 i=0;i<length;i++)
+	{
+		hash ^= (unsigned char)string[i];
+		hash *= 1099511628211ULL;
+	}
+
+	hash ^= hash >> 29;
+	hash *= 0xbf58476d1ce4e5b9ULL;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+void CStringHashIndex::Build(const CPooledStringArray& theStrings)
+{
+	strings = &theStrings;
+	numStrings = theStrings.Count();
+
+	//Power of two, at most 70% full
+	int64 numSlots = 16;
+	while(numSlots*7 < (int64)numStrings*10) numSlots *= 2;
+	uint64 mask = numSlots - 1;
+
+	slots.ReleaseVirtual();		//May view a loaded file
+	slots.ResizeArray(numSlots,true);
+	memset(slots.arr, 0, sizeof(uint64)*numSlots);
+
+	for(int i=0;i<numStrings;i++)
+	{
+		const char* string = theStrings.GetString(i);
+		int64 length = theStrings.GetLength(i);
+		uint64 hash = Hash(string, length);
+		uint64 tag = hash & 0xFFFFFFFF00000000ULL;
+
+		//Like CBidirectionalMap, a repeated string keeps the position of its first occurrence
+		bool fPresent = false;
+		int64 slot = hash & mask;
+		while(slots[slot] != 0)
+		{
+			if((slots[slot] & 0xFFFFFFFF00000000ULL) == tag && theStrings.Equals((int)(slots[slot] & 0xFFFFFFFF) - 1, string, length))
+			{
+				fPresent = true;
+				break;
+			}
+			slot = (slot + 1) & mask;
+		}
+
+		if(!fPresent) slots[slot] = tag | (uint64)(i + 1);
+	}
+}
+
+void CStringHashIndex::Attach(const CPooledStringArray& theStrings)
+{
+	if(numStrings != theStrings.Count() || slots.Count() < 16 || (slots.Count() & (slots.Count() - 1)) != 0) Build(theStrings);
+	else strings = &theStrings;
+}
+
+int CStringHashIndex::GetIndex(const BString& key) const
+{
+	if(strings == NULL) return -1;
+
+	uint64 hash = Hash(key.c_str(), key.GetLength());
+	uint64 tag = hash & 0xFFFFFFFF00000000ULL;
+	uint64 mask = slots.Count() - 1;
+
+	//The slots of a loaded index are not checked on loading, so a damaged one is caught here:
+	//positions past the strings are skipped, and probing stops after a full round
+	int64 slot = hash & mask;
+	for(int64 numProbed=0; numProbed < slots.Count() && slots[slot] != 0; numProbed++)
+	{
+		if((slots[slot] & 0xFFFFFFFF00000000ULL) == tag)
+		{
+			int64 index = (int64)(slots[slot] & 0xFFFFFFFF) - 1;
+			if(index >= 0 && index < numStrings && strings->Equals((int)index, key.c_str(), key.GetLength())) return (int)index;
+		}
+		slot = (slot + 1) & mask;
+	}
+
+	return -1;
+}
@@ -0,0 +1,62 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "BString.h"
+#include "Array.h"
+#include "StringPool.h"
+
+//Open addressing hash index over a CPooledStringArray: string -> position in the array
+//Replaces a CBidirectionalMap when the strings are already stored in an array
+
+//The index does not copy the strings, it compares with the array it is attached to
+//Each slot is a uint64: the upper 32 bits of the string's hash and (position + 1), 0 - empty slot
+//The table is at most 70% full and probed linearly, so a lookup usually reads one cache line of slots
+//and one string. A mismatching string is almost never read, because the hash bits are compared first
+
+//The slots are plain data, so they can be saved with the strings and used as soon as they are loaded (Attach())
+
+class CStringHashIndex
+{
+public:
+	CStringHashIndex():numStrings(0),strings(NULL){};
+
+public:
+	void Build(const CPooledStringArray& theStrings);		//Builds the index and attaches the strings
+	void Attach(const CPooledStringArray& theStrings);	//Attaches the strings of a loaded index, builds it if it does not match them
+	void Clear() {slots.Clear(); numStrings = 0; strings = NULL;};
+
+	int GetIndex(const BString& key) const;			//Position of the first occurrence of key in the strings, -1 if not present
+	bool IsPresent(const BString& key) const {return GetIndex(key) != -1;};
+	bool IsBuilt() const {return strings != NULL;};
+
+	static uint64 Hash(const char* string, int64 length);
+
+public:
+	//Saved with the strings
+	CHArray<uint64,int64> slots;
+	int numStrings;				//Number of strings the index was built for
+
+private:
+	const CPooledStringArray* strings;
+};
@@ -0,0 +1,189 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#include "StringPool.h"
+#include "StringHashIndex.h"
+#include <cstring>
+
+static const uint64 tagMask = 0xFFFFFFFF00000000ULL;
+
+//Copies an array that views a loaded file into memory, so that it can grow
+template <class theType, class intType>
+static void MakeArrayOwned(CHArray<theType,intType>& arr)
+{
+	if(!arr.IsVirtual()) return;
+
+	CHArray<theType,intType> copy(arr);
+	arr.ReleaseVirtual();
+	arr = copy;
+}
+
+CStringPool::CStringPool()
+{
+	Clear();
+}
+
+void CStringPool::Clear()
+{
+	blob.ReleaseVirtual();
+	offsets.ReleaseVirtual();
+	slots.ReleaseVirtual();
+
+	blob.EraseArray();
+	offsets.EraseArray();
+	slots.EraseArray();
+	offsets.AddAndExtend(0);
+}
+
+void CStringPool::MakeOwned()
+{
+	MakeArrayOwned(blob);
+	MakeArrayOwned(offsets);
+	MakeArrayOwned(slots);
+}
+
+int CStringPool::Find(const char* string, int64 length) const
+{
+	if(slots.Count() == 0) return -1;
+
+	uint64 hash = CStringHashIndex::Hash(string, length);
+	uint64 mask = slots.Count() - 1;
+
+	for(int64 slot = hash & mask; slots[slot] != 0; slot = (slot + 1) & mask)
+	{
+		if((slots[slot] & tagMask) != (hash & tagMask)) continue;
+
+		int id = (int)(slots[slot] & 0xFFFFFFFF) - 1;
+		if(Equals(id, string, length)) return id;
+	}
+
+	return -1;
+}
+
+int CStringPool::Intern(const char* string, int64 length)
+{
+	MakeOwned();
+
+	//At most 70% full
+	if(slots.Count()*7 <= (int64)(Count() + 1)*10) Rehash(slots.Count() < 16 ? 16 : slots.Count()*2);
+
+	uint64 hash = CStringHashIndex::Hash(string, length);
+	uint64 mask = slots.Count() - 1;
+
+	int64 slot = hash & mask;
+	for(; slots[slot] != 0; slot = (slot + 1) & mask)
+	{
+		if((slots[slot] & tagMask) != (hash & tagMask)) continue;
+
+		int id = (int)(slots[slot] & 0xFFFFFFFF) - 1;
+		if(Equals(id, string, length)) return id;
+	}
+
+	//New string - append it to the blob, growing the blob by doubling
+	int id = Count();
+	int64 newSize = blob.Count() + length + 1;
+	if(newSize > blob.GetSize())
+	{
+		int64 newCapacity = blob.GetSize()*2;
+		if(newCapacity < newSize) newCapacity = newSize;
+		if(newCapacity < 4096) newCapacity = 4096;
+		blob.ResizeArrayKeepPoints(newCapacity);
+	}
+
+	memcpy(blob.arr + blob.Count(), string, (size_t)length);
+	blob.arr[blob.Count() + length] = 0;
+	blob.SetNumPoints(newSize);
+
+	offsets.AddAndExtend(newSize);
+	slots[slot] = (hash & tagMask) | (uint64)(id + 1);
+
+	return id;
+}
+
+void CStringPool::Rehash(int64 numSlots)
+{
+	slots.ResizeArray(numSlots,true);
+	memset(slots.arr, 0, sizeof(uint64)*numSlots);
+	uint64 mask = numSlots - 1;
+
+	int count = Count();
+	for(int id=0;id<count;id++)
+	{
+		uint64 hash = CStringHashIndex::Hash(GetString(id), GetLength(id));
+
+		int64 slot = hash & mask;
+		while(slots[slot] != 0) slot = (slot + 1) & mask;
+		slots[slot] = (hash & tagMask) | (uint64)(id + 1);
+	}
+}
+
+BString CPooledStringArray::operator[](int index) const
+{
+	BString result;
+	result.assign(GetString(index), (size_t)GetLength(index));
+	return result;
+}
+
+void CPooledStringArray::AddAndExtend(const BString& string)
+{
+	MakeArrayOwned(ids);
+	ids.AddAndExtend(pool->Intern(string));
+}
+
+bool CPooledStringArray::WriteStrings(const BString& fileName) const
+{
+	int count = Count();
+
+	int64 numSymbols = 0;
+	for(int i=0;i<count;i++) numSymbols += GetLength(i);
+	if(count > 0) numSymbols += count - 1;		//for "\n" after every line, except the last one
+
+	CHArray<char,int64> charArr(numSymbols,true);
+	int64 curPos = 0;
+	for(int i=0;i<count;i++)
+	{
+		memcpy(charArr.arr + curPos, GetString(i), (size_t)GetLength(i));
+		curPos += GetLength(i);
+		if(i < count-1) charArr.arr[curPos++] = '\n';
+	}
+
+	return charArr.WriteBinary(fileName);
+}
+
+void CPooledStringArray::Serialize(BArchive& ar)
+{
+	CHArray<BString> strings;
+
+	if(ar.IsStoring())
+	{
+		strings.ResizeArray(Count(),true);
+		for(int i=0;i<Count();i++) strings[i] = (*this)[i];
+		strings.Serialize(ar);
+	}
+	else
+	{
+		strings.Serialize(ar);
+		EraseArray();
+		ids.ResizeArray(strings.Count());
+		for(int i=0;i<strings.Count();i++) AddAndExtend(strings[i]);
+	}
+}
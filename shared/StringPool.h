@@ -0,0 +1,101 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "BString.h"
+#include "Array.h"
+#include "BArchive.h"
+#include <cstring>
+
+//Interned strings: every distinct string is stored once, in one growing blob, and gets a 32-bit id
+//Ids are given in the order the strings are first added
+
+//The blob holds the strings with terminating zeros, offsets[id] is where string id starts
+//Interning looks up the string in an open addressing table with the same slot layout as CStringHashIndex:
+//upper 32 bits of the hash and (id + 1), 0 - empty slot
+
+//All data is in plain arrays, so a pool can be saved in the mapped format and used in place after loading
+//Interning into a loaded pool first copies its arrays into memory
+
+class CStringPool
+{
+public:
+	CStringPool();
+
+public:
+	int Intern(const char* string, int64 length);		//Id of the string, which is added if not yet present
+	int Intern(const BString& string) {return Intern(string.c_str(), string.GetLength());};
+	int Find(const char* string, int64 length) const;	//Id of the string, -1 if not present
+	int Find(const BString& string) const {return Find(string.c_str(), string.GetLength());};
+
+	const char* GetString(int id) const {return blob.arr + offsets[id];};		//Zero-terminated
+	int64 GetLength(int id) const {return offsets[id+1] - offsets[id] - 1;};
+	bool Equals(int id, const char* string, int64 length) const
+		{return GetLength(id) == length && memcmp(GetString(id), string, (size_t)length) == 0;};
+
+	int Count() const {return offsets.Count() > 0 ? (int)(offsets.Count() - 1) : 0;};
+	int64 BlobSize() const {return blob.Count();};
+	void Clear();
+
+public:
+	//Saved in the mapped format
+	CHArray<char,int64> blob;
+	CHArray<int64,int64> offsets;		//Start of every string in the blob, plus the end
+	CHArray<uint64,int64> slots;
+
+private:
+	void Rehash(int64 numSlots);
+	void MakeOwned();					//Copies arrays that view a loaded file into memory
+};
+
+//Array of strings kept in a CStringPool - only the ids are stored in the array
+//Several arrays can share one pool, so a string that is in several of them is stored once
+//Reading mirrors CHArray<BString>, except that operator[] returns a copy
+
+class CPooledStringArray
+{
+public:
+	CPooledStringArray(CStringPool& thePool):pool(&thePool){};
+
+public:
+	int Count() const {return ids.Count();};
+	bool IsEmpty() const {return ids.IsEmpty();};
+
+	BString operator[](int index) const;
+	const char* GetString(int index) const {return pool->GetString(ids[index]);};
+	int64 GetLength(int index) const {return pool->GetLength(ids[index]);};
+	bool Equals(int index, const char* string, int64 length) const {return pool->Equals(ids[index], string, length);};
+
+	void AddAndExtend(const BString& string);
+	void EraseArray() {ids.ReleaseVirtual(); ids.EraseArray();};
+	void Clear() {EraseArray();};
+
+	bool WriteStrings(const BString& fileName) const;	//One string per line, like CHArray<BString>::WriteStrings()
+	void Serialize(BArchive& ar);						//In the CHArray<BString> format
+
+public:
+	CHArray<int> ids;		//Saved in the mapped format
+
+private:
+	CStringPool* pool;
+};
@@ -0,0 +1,176 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#include "ThreadPool.h"
+#include "boost/thread.hpp"
+#include <deque>
+#include <algorithm>
+
+namespace
+{
+	//Jobs of one Run() call
+	struct Batch
+	{
+		const std::function<void(int)>* job;
+		int numJobs;
+		int next;			//Next job to be taken
+		int numDone;
+	};
+
+	//Never destroyed, so that the workers can still be waiting on it at exit
+	struct PoolState
+	{
+		PoolState():numThreads(0),fStarted(false){}
+
+		boost::mutex mutex;
+		boost::condition_variable workCondition;	//A batch was queued
+		boost::condition_variable doneCondition;	//A job was finished
+		std::deque<Batch*> batches;					//Batches with jobs not taken yet
+		boost::thread_group workers;
+		int numThreads;
+		bool fStarted;
+	};
+
+	PoolState& State()
+	{
+		static PoolState* state = new PoolState;
+		return *state;
+	}
+
+	boost::thread_specific_ptr<bool> inJob;		//Set while a thread runs a job
+
+	//Takes the next job of the batch, removes the batch from the queue when its last job is taken
+	//The mutex is locked
+	int TakeJob(PoolState& state, Batch* batch)
+	{
+		int job = batch->next++;
+		if(batch->next == batch->numJobs)
+		{
+			state.batches.erase(std::find(state.batches.begin(), state.batches.end(), batch));
+		}
+		return job;
+	}
+
+	void RunJob(Batch* batch, int job)
+	{
+		if(inJob.get() == NULL) inJob.reset(new bool(false));
+		bool fWasInJob = *inJob;
+
+		*inJob = true;
+		(*batch->job)(job);
+		*inJob = fWasInJob;
+	}
+
+	void WorkerThread()
+	{
+		PoolState& state = State();
+		boost::mutex::scoped_lock lock(state.mutex);
+
+		while(true)
+		{
+			while(state.batches.empty()) state.workCondition.wait(lock);
+
+			Batch* batch = state.batches.front();
+			int job = TakeJob(state, batch);
+
+			lock.unlock();
+			RunJob(batch, job);
+			lock.lock();
+
+			//The batch may be gone once its last job is counted
+			batch->numDone++;
+			if(batch->numDone == batch->numJobs) state.doneCondition.notify_all();
+		}
+	}
+}
+
+int CThreadPool::NumThreads()
+{
+	PoolState& state = State();
+	boost::mutex::scoped_lock lock(state.mutex);
+
+	if(state.numThreads <= 0)
+	{
+		state.numThreads = (int)boost::thread::hardware_concurrency();
+		if(state.numThreads <= 0) state.numThreads = 1;
+	}
+	return state.numThreads;
+}
+
+void CThreadPool::SetNumThreads(int numThreads)
+{
+	PoolState& state = State();
+	boost::mutex::scoped_lock lock(state.mutex);
+
+	if(state.fStarted) return;
+	state.numThreads = numThreads;
+}
+
+int CThreadPool::NumJobs(long long count, long long minPerJob)
+{
+	if(minPerJob < 1) minPerJob = 1;
+
+	long long numJobs = count / minPerJob;
+	numJobs = std::min(numJobs, (long long)NumThreads());
+	return numJobs < 1 ? 1 : (int)numJobs;
+}
+
+void CThreadPool::Run(int numJobs, const std::function<void(int)>& job)
+{
+	if(numJobs <= 0) return;
+
+	//Serial if there is nothing to share, or if called from a job
+	bool fNested = (inJob.get() != NULL && *inJob);
+	if(numJobs == 1 || fNested || NumThreads() <= 1)
+	{
+		for(int i=0; i < numJobs; i++) job(i);
+		return;
+	}
+
+	PoolState& state = State();
+	Batch batch = {&job, numJobs, 0, 0};
+
+	boost::mutex::scoped_lock lock(state.mutex);
+
+	if(!state.fStarted)
+	{
+		for(int i=1; i < state.numThreads; i++) state.workers.create_thread(WorkerThread);
+		state.fStarted = true;
+	}
+
+	state.batches.push_back(&batch);
+	state.workCondition.notify_all();
+
+	//The calling thread takes jobs of its own batch until none are left, then waits for the workers
+	while(batch.next < batch.numJobs)
+	{
+		int curJob = TakeJob(state, &batch);
+
+		lock.unlock();
+		RunJob(&batch, curJob);
+		lock.lock();
+
+		batch.numDone++;
+	}
+
+	while(batch.numDone < batch.numJobs) state.doneCondition.wait(lock);
+}
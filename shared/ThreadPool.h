@@ -0,0 +1,64 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include <functional>
+
+//Shared pool of worker threads for data-parallel loops - the parallel sorts and Permute in Array.h,
+//and the sections of large pages in CWikipediaParser
+//The threads are started on first use, one per core less one: the calling thread runs jobs too
+//Several threads may call Run() at once, their jobs share the workers
+//A job that calls Run() runs the nested jobs itself, so nested calls do not wait for busy workers
+
+//Does not include Array.h, which includes this file
+
+class CThreadPool
+{
+public:
+	//Runs job(0) ... job(numJobs-1) and returns when all of them are done
+	static void Run(int numJobs, const std::function<void(int)>& job);
+
+	//Splits [0, count) into ranges of at least minPerJob points, at most one per thread, and runs func(begin, end) on each
+	template<class F> static void ParallelFor(long long count, long long minPerJob, F func);
+
+	static int NumJobs(long long count, long long minPerJob);		//Number of ranges ParallelFor() would use
+	static int NumThreads();										//Including the calling thread
+	static void SetNumThreads(int numThreads);						//0 - one per core (default), 1 - no worker threads
+																	//Call before the first Run()
+};
+
+template<class F>
+void CThreadPool::ParallelFor(long long count, long long minPerJob, F func)
+{
+	int numJobs = NumJobs(count, minPerJob);
+	if(numJobs <= 1)
+	{
+		if(count > 0) func(0LL, count);
+		return;
+	}
+
+	Run(numJobs, [&](int job)
+	{
+		func((count*job)/numJobs, (count*(job+1))/numJobs);
+	});
+}
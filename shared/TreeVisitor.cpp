@@ -0,0 +1,130 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#include "TreeVisitor.h"
+#include <chrono>
+
+//Adds a pass, visit or leave can be empty
+void CTreeVisitor::AddPass(const BString& name, VisitHandler visit, LeaveHandler leave/*=LeaveHandler()*/)
+{
+	if(passes.size() >= 32) return;
+
+	Pass pass;
+	pass.name = name;
+	pass.visit = visit;
+	pass.leave = leave;
+	pass.seconds = 0;
+	passes.push_back(pass);
+}
+
+//Visits all element nodes below root
+void CTreeVisitor::Run(xml_node& root)
+{
+	if(passes.empty()) return;
+
+	stoppedPasses = 0;
+	unsigned int mask = (passes.size() == 32) ? 0xFFFFFFFFu : ((1u << passes.size()) - 1);
+	VisitChildren(root, mask);
+}
+
+void CTreeVisitor::VisitChildren(xml_node& node, unsigned int mask)
+{
+	xml_node child = node.first_child();
+	while(child)
+	{
+		if((mask & ~stoppedPasses) == 0) return;		//All passes are done
+
+		xml_node next = child.next_sibling();		//child may be removed
+		if(child.type() == pugi::node_element) Visit(child, mask);
+		child = next;
+	}
+}
+
+//Visits the node with the passes in mask, returns false if the node was removed
+bool CTreeVisitor::Visit(xml_node& node, unsigned int mask)
+{
+	unsigned int childMask = 0;		//Passes that visit the children
+	unsigned int leaveMask = 0;		//Passes whose leave handler is called
+	int numPasses = (int)passes.size();
+
+	for(int i = 0; i < numPasses; i++)
+	{
+		unsigned int bit = 1u << i;
+		if(!(mask & bit) || (stoppedPasses & bit)) continue;
+
+		xml_node before = node.previous_sibling();
+		VisitResult res = CallVisit(i, node);
+
+		//Nodes inserted in front of this one are visited by the passes after this one
+		xml_node inserted = before ? before.next_sibling() : node.parent().first_child();
+		if(inserted != node)
+		{
+			unsigned int laterMask = mask & ~((bit << 1) - 1);
+			while(inserted && inserted != node)
+			{
+				xml_node next = inserted.next_sibling();
+				if(laterMask && inserted.type() == pugi::node_element) Visit(inserted, laterMask);
+				inserted = next;
+			}
+		}
+
+		if(res == visitRemove)
+		{
+			node.parent().remove_child(node);
+			return false;
+		}
+
+		if(res == visitStop) {stoppedPasses |= bit; continue;}
+
+		leaveMask |= bit;
+		if(res == visitContinue) childMask |= bit;
+	}
+
+	if(childMask) VisitChildren(node, childMask);
+
+	for(int i = 0; i < numPasses; i++)
+	{
+		if((leaveMask & (1u << i)) && passes[i].leave) CallLeave(i, node);
+	}
+
+	return true;
+}
+
+CTreeVisitor::VisitResult CTreeVisitor::CallVisit(int pass, xml_node& node)
+{
+	if(!passes[pass].visit) return visitContinue;
+	if(!fTiming) return passes[pass].visit(node);
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	VisitResult res = passes[pass].visit(node);
+	passes[pass].seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return res;
+}
+
+void CTreeVisitor::CallLeave(int pass, xml_node& node)
+{
+	if(!fTiming) {passes[pass].leave(node); return;}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	passes[pass].leave(node);
+	passes[pass].seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
@@ -0,0 +1,94 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "pugixml.hpp"
+#include "BString.h"
+#include <functional>
+#include <vector>
+
+using pugi::xml_node;
+
+//Runs several passes over an XML tree in a single traversal
+//Each pass has a visit handler, called on every element node before its children (document order),
+//and optionally a leave handler, called after its children have been visited
+//
+//On each node, the handlers run in the order in which the passes were added - this is the ordering constraint:
+//a pass added later sees every node after all earlier passes have processed it.
+//A pass that needs the result of another pass on the whole tree must run in a later traversal.
+//Nodes that a visit handler inserts in front of the current node are visited by the passes added after it.
+//
+//At most 32 passes per visitor
+
+class CTreeVisitor
+{
+public:
+	enum VisitResult
+	{
+		visitContinue,			//Visit the children of the node
+		visitSkipChildren,		//This pass does not visit the children, other passes still do
+		visitRemove,			//Remove the node - no further pass sees it or its children
+		visitStop				//This pass is done for the rest of the traversal
+	};
+
+	typedef std::function<VisitResult(xml_node&)> VisitHandler;
+	typedef std::function<void(xml_node&)> LeaveHandler;
+
+	CTreeVisitor():fTiming(false),stoppedPasses(0){};
+	~CTreeVisitor(){};
+
+public:
+	//Adds a pass, visit or leave can be empty
+	void AddPass(const BString& name, VisitHandler visit, LeaveHandler leave = LeaveHandler());
+
+	//Visits all element nodes below root, root itself is not visited
+	void Run(xml_node& root);
+
+	//Per-pass timing, accumulated over all Run() calls
+	void SetTiming(bool val){fTiming = val;};
+	int NumPasses() const {return (int)passes.size();};
+	const BString& PassName(int pass) const {return passes[pass].name;};
+	double PassSeconds(int pass) const {return passes[pass].seconds;};
+
+private:
+	struct Pass
+	{
+		BString name;
+		VisitHandler visit;
+		LeaveHandler leave;
+		double seconds;
+	};
+
+	std::vector<Pass> passes;
+	bool fTiming;
+
+	//Passes are bits in the masks
+	unsigned int stoppedPasses;
+
+	//Visits the node with the passes in mask, returns false if the node was removed
+	bool Visit(xml_node& node, unsigned int mask);
+	void VisitChildren(xml_node& node, unsigned int mask);
+
+	VisitResult CallVisit(int pass, xml_node& node);
+	void CallLeave(int pass, xml_node& node);
+};
@@ -0,0 +1,187 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#pragma once
+#include "Array.h"
+#include <string.h>
+
+//Pull-based tokenizer over XML text, for reading XML without building a DOM
+//Returns text runs, start tags and end tags one by one, pointing into the original buffer
+//Text is returned raw, as pugixml returns it with parse_ws_pcdata only (see SimplestXml::StringToXml):
+//entities are not decoded and whitespace-only text is kept
+//Comments, CDATA, processing instructions and doctype are skipped - pugixml drops them with these flags too
+//The buffer must stay unchanged while the tokenizer is used
+
+class XmlStreamTokenizer
+{
+public:
+	enum TokenType {tokenEnd, tokenText, tokenStartTag, tokenEndTag};
+
+	XmlStreamTokenizer(const char* data, int64 length):
+		pos(data),
+		end(data+length),
+		value(NULL),
+		valueLength(0),
+		attributes(NULL),
+		attributesLength(0),
+		fSelfClosing(false)
+		{};
+
+public:
+	//Current token - text run, or tag name for start and end tags
+	const char* value;
+	int valueLength;
+
+	//For start tags - the raw attribute string, and whether the tag is self-closing, <par />
+	const char* attributes;
+	int attributesLength;
+	bool fSelfClosing;
+
+public:
+	//Reads the next token, returns tokenEnd at the end of the buffer
+	TokenType Next()
+	{
+		while(pos < end)
+		{
+			if(*pos != '<')		//Text up to the next tag
+			{
+				const char* textEnd = (const char*)memchr(pos, '<', end-pos);
+				if(textEnd == NULL) textEnd = end;
+
+				value = pos;
+				valueLength = (int)(textEnd-pos);
+				fSelfClosing = false;
+				pos = textEnd;
+				return tokenText;
+			}
+
+			//Markup that does not produce nodes
+			if(pos+1 < end && (pos[1] == '!' || pos[1] == '?'))
+			{
+				if(StartsWith("<!--")) SkipPast("-->");
+				else if(StartsWith("<![CDATA[")) SkipPast("]]>");
+				else if(pos[1] == '?') SkipPast("?>");
+				else SkipPast(">");
+				continue;
+			}
+
+			bool fEndTag = (pos+1 < end && pos[1] == '/');
+			pos += fEndTag ? 2 : 1;
+
+			//Tag name
+			value = pos;
+			while(pos < end && !IsNameEnd(*pos)) pos++;
+			valueLength = (int)(pos-value);
+
+			//Attributes, up to the closing brace - attribute values cannot contain '>' in escaped XML
+			attributes = pos;
+			const char* tagEnd = (const char*)memchr(pos, '>', end-pos);
+			if(tagEnd == NULL) tagEnd = end;
+
+			fSelfClosing = (!fEndTag && tagEnd > pos && tagEnd[-1] == '/');
+			attributesLength = (int)(tagEnd-pos) - (fSelfClosing ? 1 : 0);
+			pos = (tagEnd < end) ? tagEnd+1 : end;
+
+			return fEndTag ? tokenEndTag : tokenStartTag;
+		}
+
+		return tokenEnd;
+	}
+
+	//Whether the current tag has the given name
+	bool NameIs(const char* name) const
+	{
+		return strncmp(value, name, valueLength) == 0 && name[valueLength] == 0;
+	}
+
+	//Extracts a raw attribute value from the current start tag, returns false if the attribute is not present
+	bool GetAttribute(const char* name, BString& result) const
+	{
+		int nameLength = (int)strlen(name);
+		const char* cur = attributes;
+		const char* attrEnd = attributes + attributesLength;
+
+		while(cur < attrEnd)
+		{
+			while(cur < attrEnd && IsSpace(*cur)) cur++;
+			const char* curName = cur;
+			while(cur < attrEnd && *cur != '=' && !IsSpace(*cur)) cur++;
+			int curNameLength = (int)(cur-curName);
+
+			while(cur < attrEnd && *cur != '"' && *cur != '\'') cur++;
+			if(cur >= attrEnd) return false;
+
+			char quote = *cur++;
+			const char* curValue = cur;
+			while(cur < attrEnd && *cur != quote) cur++;
+
+			if(curNameLength == nameLength && strncmp(curName, name, nameLength) == 0)
+			{
+				result.assign(curValue, cur-curValue);
+				return true;
+			}
+			cur++;
+		}
+
+		return false;
+	}
+
+	//Skips everything up to and including the end tag of the start tag that has just been read
+	void SkipElement()
+	{
+		if(fSelfClosing) return;
+		SkipToEndTag();
+	}
+
+	//Skips the rest of the currently open element, up to and including its end tag
+	void SkipToEndTag()
+	{
+		int depth = 1;
+		while(depth > 0)
+		{
+			TokenType type = Next();
+			if(type == tokenEnd) return;
+			if(type == tokenStartTag && !fSelfClosing) depth++;
+			if(type == tokenEndTag) depth--;
+		}
+	}
+
+private:
+	const char* pos;
+	const char* end;
+
+	static bool IsSpace(char symbol) {return symbol == ' ' || symbol == '\t' || symbol == '\n' || symbol == '\r';}
+	static bool IsNameEnd(char symbol) {return IsSpace(symbol) || symbol == '>' || symbol == '/';}
+
+	bool StartsWith(const char* marker) const
+	{
+		int length = (int)strlen(marker);
+		return (end-pos) >= length && strncmp(pos, marker, length) == 0;
+	}
+
+	void SkipPast(const char* marker)
+	{
+		int length = (int)strlen(marker);
+		while(pos < end && !StartsWith(marker)) pos++;
+		pos = (pos < end) ? pos+length : end;
+	}
+};
@@ -0,0 +1,90 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#include "XmlTags.h"
+#include <cstring>
+
+namespace
+{
+	//Same order as the XmlTag enum
+	const char* const tagNames[numXmlTags] =
+	{
+		"",
+		"page", "title", "url", "text", "firstPara", "section", "secTitle", "secContent", "par", "list", "listEl",
+		"link", "extLink", "target", "anchor", "param", "template", "file", "caption", "media", "category",
+		"interwiki", "gallery", "infobox",
+		"wTable", "div", "style"
+	};
+
+	//Open addressing table from the hash of a name to its tag, tagUnknown - empty slot
+	const int numSlots = 128;
+
+	inline unsigned int NameHash(const char* name, size_t length)
+	{
+		return (unsigned int)(length*31 + (unsigned char)name[0]*7 + (unsigned char)name[length-1]) & (numSlots-1);
+	}
+
+	struct TagTable
+	{
+		XmlTag slots[numSlots];
+
+		TagTable()
+		{
+			for(int i=0;i<numSlots;i++) slots[i] = tagUnknown;
+
+			for(int tag=1;tag<numXmlTags;tag++)
+			{
+				unsigned int slot = NameHash(tagNames[tag], strlen(tagNames[tag]));
+				while(slots[slot] != tagUnknown) slot = (slot+1) & (numSlots-1);
+				slots[slot] = (XmlTag)tag;
+			}
+		}
+	};
+
+	const TagTable tagTable;
+}
+
+XmlTag XmlTags::GetTag(const char* name, size_t length)
+{
+	if(length == 0) return tagUnknown;
+
+	unsigned int slot = NameHash(name, length);
+	while(tagTable.slots[slot] != tagUnknown)
+	{
+		const char* cur = tagNames[tagTable.slots[slot]];
+		if(strncmp(cur, name, length) == 0 && cur[length] == 0) return tagTable.slots[slot];
+		slot = (slot+1) & (numSlots-1);
+	}
+
+	return tagUnknown;
+}
+
+XmlTag XmlTags::GetTag(const char* name)
+{
+	return GetTag(name, strlen(name));
+}
+
+const char* XmlTags::TagName(XmlTag tag)
+{
+	if(tag <= tagUnknown || tag >= numXmlTags) return "";
+	return tagNames[tag];
+}
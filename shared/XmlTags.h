@@ -0,0 +1,80 @@
+/* Copyright (c) 2018 Peter Kondratyuk. All Rights Reserved.
+*
+* You may use, distribute and modify the code in this file under the terms of the MIT Open Source license, however
+* if this file is included as part of a larger project, the project as a whole may be distributed under a different
+* license.
+*
+* MIT license:
+* Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+* documentation files (the "Software"), to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and
+* to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all copies or substantial portions
+* of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED
+* TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+* CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+* IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "pugixml.hpp"
+#include <cstddef>
+
+//Element names of the parsed page XML
+//Traversals compare tags instead of building a BString from node.name() on every node
+//Names that are not in the list (Tidy output, etc.) are tagUnknown
+enum XmlTag
+{
+	tagUnknown = 0,
+
+	//Page structure
+	tagPage,
+	tagTitle,
+	tagUrl,
+	tagText,
+	tagFirstPara,
+	tagSection,
+	tagSecTitle,
+	tagSecContent,
+	tagPar,
+	tagList,
+	tagListEl,
+
+	//Links, templates and files
+	tagLink,
+	tagExtLink,
+	tagTarget,
+	tagAnchor,
+	tagParam,
+	tagTemplate,
+	tagFile,
+	tagCaption,
+	tagMedia,
+	tagCategory,
+	tagInterwiki,
+	tagGallery,
+	tagInfobox,
+
+	//Removed or skipped markup
+	tagWTable,
+	tagDiv,
+	tagStyle,
+
+	numXmlTags
+};
+
+namespace XmlTags
+{
+	//Name to tag, no allocations - one hash and one string comparison
+	XmlTag GetTag(const char* name, size_t length);
+	XmlTag GetTag(const char* name);
+	inline XmlTag GetTag(const pugi::xml_node& node) {return GetTag(node.name());};
+
+	//Tag to name, "" for tagUnknown
+	const char* TagName(XmlTag tag);
+}